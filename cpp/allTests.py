@@ -75,6 +75,7 @@ tests = [
     ("Ice/invoke", ["core"]),
     ("Ice/plugin", ["core", "nomingw"]),
     ("Ice/hash", ["once"]),
+    ("Ice/collocated", ["core"]),
     ("Ice/admin", ["core", "noipv6"]),
     ("Ice/metrics", ["core", "nows", "noipv6", "nocompress", "nomingw", "nosocks"]),
     ("Ice/enums", ["once", "bt"]),
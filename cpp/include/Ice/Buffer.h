@@ -74,6 +74,20 @@ public:
             return _size;
         }
 
+        size_type capacity() const
+        {
+            return _capacity;
+        }
+
+        //
+        // The number of times the memory of the container was grown
+        // after its initial allocation.
+        //
+        int reallocations() const
+        {
+            return _reallocations;
+        }
+
         bool empty() const
         {
             return !_size;
@@ -137,16 +151,23 @@ public:
             return _buf[n];
         }
 
+        //
+        // Grows or shrinks the capacity of the container to hold at
+        // least n bytes (the capacity is never reduced below 240 bytes
+        // when growing).
+        //
+        void reserve(size_type);
+
     private:
 
         Container(const Container&);
         void operator=(const Container&);
-        void reserve(size_type);
 
         pointer _buf;
         size_type _size;
         size_type _capacity;
         int _shrinkCounter;
+        int _reallocations;
         bool _owned;
     };
 
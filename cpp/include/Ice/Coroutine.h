@@ -0,0 +1,400 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_COROUTINE_H
+#define ICE_COROUTINE_H
+
+#include <IceUtil/Config.h>
+
+#ifdef ICE_COROUTINES
+
+#include <Ice/OutgoingAsync.h>
+#include <atomic>
+#include <coroutine>
+#include <functional>
+
+namespace IceInternal
+{
+
+//
+// Completion callback for invocations awaited by a coroutine. The
+// coroutine is resumed from the thread that would otherwise call the
+// response or exception lambdas, that is a thread from the client thread
+// pool or the dispatcher configured with InitializationData.
+//
+class CoroutineInvoke : virtual public OutgoingAsyncCompletionCallback
+{
+public:
+
+    CoroutineInvoke() :
+        _ready(false)
+    {
+    }
+
+    bool ready() const
+    {
+        return _ready.load();
+    }
+
+    //
+    // Returns false, and leaves the coroutine running, if the invocation
+    // completed before the coroutine could be suspended. Otherwise, the
+    // coroutine is resumed on completion.
+    //
+    bool suspend(std::coroutine_handle<> handle)
+    {
+        _handle = handle;
+        return !_ready.exchange(true);
+    }
+
+protected:
+
+    virtual void readResponse(bool) = 0;
+
+    void rethrow() const
+    {
+        if(_exception)
+        {
+            std::rethrow_exception(_exception);
+        }
+    }
+
+private:
+
+    virtual bool handleSent(bool done, bool) override
+    {
+        return done; // Oneway invocations are completed once sent.
+    }
+
+    virtual bool handleException(const Ice::Exception&) override
+    {
+        return true;
+    }
+
+    virtual bool handleResponse(bool) override
+    {
+        return true;
+    }
+
+    virtual void handleInvokeSent(bool, OutgoingAsyncBase*) const override
+    {
+        complete();
+    }
+
+    virtual void handleInvokeException(const Ice::Exception& ex, OutgoingAsyncBase*) const override
+    {
+        try
+        {
+            ex.ice_throw();
+        }
+        catch(const Ice::Exception&)
+        {
+            _exception = std::current_exception();
+        }
+        complete();
+    }
+
+    virtual void handleInvokeResponse(bool ok, OutgoingAsyncBase*) const override
+    {
+        try
+        {
+            const_cast<CoroutineInvoke*>(this)->readResponse(ok);
+        }
+        catch(...)
+        {
+            _exception = std::current_exception();
+        }
+        complete();
+    }
+
+    void complete() const
+    {
+        if(_ready.exchange(true))
+        {
+            _handle.resume();
+        }
+    }
+
+    mutable std::atomic<bool> _ready;
+    mutable std::exception_ptr _exception;
+    std::coroutine_handle<> _handle;
+};
+
+template<typename R>
+class CoroutineOutgoing : public OutgoingAsyncT<R>, public CoroutineInvoke
+{
+public:
+
+    CoroutineOutgoing(const std::shared_ptr<Ice::ObjectPrx>& proxy) :
+        OutgoingAsyncT<R>(proxy, false)
+    {
+    }
+
+    R result()
+    {
+        rethrow();
+        return std::move(_result);
+    }
+
+protected:
+
+    virtual void readResponse(bool ok) override
+    {
+        if(!ok)
+        {
+            this->throwUserException();
+        }
+        assert(this->_read);
+        this->_is.startEncapsulation();
+        _result = this->_read(&this->_is);
+        this->_is.endEncapsulation();
+    }
+
+private:
+
+    R _result;
+};
+
+template<>
+class CoroutineOutgoing<void> : public OutgoingAsyncT<void>, public CoroutineInvoke
+{
+public:
+
+    CoroutineOutgoing(const std::shared_ptr<Ice::ObjectPrx>& proxy) :
+        OutgoingAsyncT<void>(proxy, false)
+    {
+    }
+
+    void result()
+    {
+        rethrow();
+    }
+
+protected:
+
+    virtual void readResponse(bool ok) override
+    {
+        if(!ok)
+        {
+            this->throwUserException();
+        }
+        else if(!this->_is.b.empty())
+        {
+            this->_is.skipEmptyEncapsulation();
+        }
+    }
+};
+
+}
+
+namespace Ice
+{
+
+//
+// The awaitable returned by the generated <op>Co proxy methods. The
+// invocation is sent when the method is called, co_await returns the
+// result of the operation or throws its exception.
+//
+template<typename R>
+class Awaitable
+{
+public:
+
+    explicit Awaitable(std::shared_ptr<IceInternal::CoroutineOutgoing<R>> outAsync) :
+        _outAsync(std::move(outAsync))
+    {
+    }
+
+    bool await_ready() const
+    {
+        return _outAsync->ready();
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        return _outAsync->suspend(handle);
+    }
+
+    R await_resume()
+    {
+        return _outAsync->result();
+    }
+
+private:
+
+    std::shared_ptr<IceInternal::CoroutineOutgoing<R>> _outAsync;
+};
+
+//
+// The return type of the servant methods generated for operations with the
+// cpp:coroutine metadata. The coroutine starts when the request is
+// dispatched; the value given to co_return is sent as the response and an
+// exception escaping the coroutine is sent as the exception.
+//
+template<typename T>
+class DispatchTask
+{
+public:
+
+    class promise_type
+    {
+    public:
+
+        DispatchTask get_return_object()
+        {
+            return DispatchTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return std::suspend_always();
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return std::suspend_never();
+        }
+
+        void return_value(T v)
+        {
+            _response(std::move(v));
+        }
+
+        void unhandled_exception()
+        {
+            _exception(std::current_exception());
+        }
+
+    private:
+
+        friend class DispatchTask;
+
+        std::function<void(T)> _response;
+        std::function<void(std::exception_ptr)> _exception;
+    };
+
+    DispatchTask(DispatchTask&& other) :
+        _handle(other._handle)
+    {
+        other._handle = nullptr;
+    }
+
+    DispatchTask(const DispatchTask&) = delete;
+    DispatchTask& operator=(const DispatchTask&) = delete;
+
+    ~DispatchTask()
+    {
+        if(_handle)
+        {
+            _handle.destroy(); // Never started
+        }
+    }
+
+    void __dispatch(std::function<void(T)> response, std::function<void(std::exception_ptr)> exception)
+    {
+        auto handle = _handle;
+        _handle = nullptr;
+        handle.promise()._response = std::move(response);
+        handle.promise()._exception = std::move(exception);
+        handle.resume();
+    }
+
+private:
+
+    explicit DispatchTask(std::coroutine_handle<promise_type> handle) :
+        _handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> _handle;
+};
+
+template<>
+class DispatchTask<void>
+{
+public:
+
+    class promise_type
+    {
+    public:
+
+        DispatchTask get_return_object()
+        {
+            return DispatchTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return std::suspend_always();
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return std::suspend_never();
+        }
+
+        void return_void()
+        {
+            _response();
+        }
+
+        void unhandled_exception()
+        {
+            _exception(std::current_exception());
+        }
+
+    private:
+
+        friend class DispatchTask;
+
+        std::function<void()> _response;
+        std::function<void(std::exception_ptr)> _exception;
+    };
+
+    DispatchTask(DispatchTask&& other) :
+        _handle(other._handle)
+    {
+        other._handle = nullptr;
+    }
+
+    DispatchTask(const DispatchTask&) = delete;
+    DispatchTask& operator=(const DispatchTask&) = delete;
+
+    ~DispatchTask()
+    {
+        if(_handle)
+        {
+            _handle.destroy(); // Never started
+        }
+    }
+
+    void __dispatch(std::function<void()> response, std::function<void(std::exception_ptr)> exception)
+    {
+        auto handle = _handle;
+        _handle = nullptr;
+        handle.promise()._response = std::move(response);
+        handle.promise()._exception = std::move(exception);
+        handle.resume();
+    }
+
+private:
+
+    explicit DispatchTask(std::coroutine_handle<promise_type> handle) :
+        _handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> _handle;
+};
+
+}
+
+#endif
+
+#endif
@@ -46,6 +46,7 @@
 #include <Ice/NativePropertiesAdmin.h>
 #include <Ice/Instrumentation.h>
 #include <Ice/Metrics.h>
+#include <Ice/CircuitBreakerAdmin.h>
 #include <Ice/SliceChecksums.h>
 #if !defined(ICE_OS_WINRT) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
 #   include <Ice/Service.h>
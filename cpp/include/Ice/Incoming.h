@@ -10,6 +10,7 @@
 #ifndef ICE_INCOMING_H
 #define ICE_INCOMING_H
 
+#include <IceUtil/Time.h>
 #include <Ice/InstanceF.h>
 #include <Ice/ConnectionIF.h>
 #include <Ice/ServantLocatorF.h>
@@ -142,7 +143,20 @@ public:
         _format = format;
     }
 
-    void invoke(const ServantManagerPtr&, Ice::InputStream*);
+    //
+    // The last argument is the number of requests following this
+    // request in the batch. Operations with the cpp:batch metadata
+    // dispatch the following requests with the same header along with
+    // this request, batchDispatched() returns how many of them.
+    //
+    void invoke(const ServantManagerPtr&, Ice::InputStream*, const IceUtil::Time&, Ice::Int = 0);
+
+    bool nextBatchRequest();
+
+    Ice::Int batchDispatched() const
+    {
+        return _batchDispatched;
+    }
 
     // Inlined for speed optimization.
     void skipReadParams()
@@ -177,6 +191,10 @@ private:
 
     Ice::InputStream* _is;
     Ice::Byte* _inParamPos;
+    Ice::Byte* _header;
+    Ice::Int _headerSize;
+    Ice::Int _batchRemaining;
+    Ice::Int _batchDispatched;
 
     IncomingAsyncPtr _inAsync;
 };
@@ -24,6 +24,14 @@
 #include <Ice/StreamHelpers.h>
 #include <Ice/FactoryTable.h>
 
+namespace IceUtilInternal
+{
+
+class MappedFile;
+typedef IceUtil::Handle<MappedFile> MappedFilePtr;
+
+}
+
 namespace Ice
 {
 
@@ -88,6 +96,12 @@ public:
     InputStream(const CommunicatorPtr&, const EncodingVersion&, const std::pair<const Byte*, const Byte*>&);
     InputStream(const CommunicatorPtr&, const EncodingVersion&, IceInternal::Buffer&, bool = false);
 
+    //
+    // This constructor reads the contents of a memory mapped file in place,
+    // the stream keeps the mapping alive.
+    //
+    InputStream(const CommunicatorPtr&, const EncodingVersion&, const IceUtilInternal::MappedFilePtr&);
+
     ~InputStream()
     {
         // Inlined for performance reasons.
@@ -973,6 +987,10 @@ private:
     std::vector<std::function<void()>> _deleters;
 #endif
 
+    //
+    // Keeps alive the memory mapped file the stream reads from, if any.
+    //
+    IceUtil::Handle<IceUtil::Shared> _mappedFile;
 };
 
 } // End namespace Ice
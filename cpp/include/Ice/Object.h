@@ -12,6 +12,7 @@
 
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Shared.h>
+#include <IceUtil/StringUtil.h>
 #include <Ice/ObjectF.h>
 #include <Ice/ProxyF.h>
 #include <Ice/IncomingAsyncF.h>
@@ -33,6 +34,19 @@ class Incoming;
 class Direct;
 class GCVisitor;
 
+//
+// Returns the position of the given operation in the sorted operation
+// names of a servant, or -1 if the servant doesn't implement it. The slot
+// table is the perfect hash table generated by slice2cpp for these names.
+//
+inline int
+operationIndex(const std::string& operation, const std::string* names, const short* slots,
+               unsigned int mask, unsigned int seed)
+{
+    int i = slots[IceUtilInternal::hashString(operation, seed) & mask];
+    return i >= 0 && names[i] == operation ? i : -1;
+}
+
 }
 
 namespace Ice
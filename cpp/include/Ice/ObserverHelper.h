@@ -106,6 +106,46 @@ protected:
     TPtr _observer;
 };
 
+//
+// The built-in metrics observers implement this interface in addition
+// to the Ice::Instrumentation interfaces to be notified of marshaling
+// events specific to the C++ runtime.
+//
+class ICE_API MarshalObserver
+{
+public:
+
+    virtual ~MarshalObserver();
+
+    virtual void reallocated(Ice::Int) = 0;
+};
+
+//
+// The built-in invocation metrics observer implements this interface
+// to be notified of the hedged requests sent for an invocation.
+//
+class ICE_API HedgeObserver
+{
+public:
+
+    virtual ~HedgeObserver();
+
+    virtual void hedged() = 0;
+};
+
+//
+// The built-in invocation metrics observer implements this interface
+// to be notified of the retries denied by the retry budget.
+//
+class ICE_API RetryBudgetObserver
+{
+public:
+
+    virtual ~RetryBudgetObserver();
+
+    virtual void retryBudgetExhausted() = 0;
+};
+
 class ICE_API DispatchObserver : public ObserverHelperT<Ice::Instrumentation::DispatchObserver>
 {
 public:
@@ -125,6 +165,18 @@ public:
             _observer->reply(size);
         }
     }
+
+    void reallocated(Ice::Int count)
+    {
+        if(_observer && count > 0)
+        {
+            MarshalObserver* observer = dynamic_cast<MarshalObserver*>(_observer.get());
+            if(observer)
+            {
+                observer->reallocated(count);
+            }
+        }
+    }
 };
 
 class ICE_API InvocationObserver : public ObserverHelperT<Ice::Instrumentation::InvocationObserver>
@@ -177,6 +229,45 @@ public:
         }
     }
 
+    void
+    reallocated(Ice::Int count)
+    {
+        if(_observer && count > 0)
+        {
+            MarshalObserver* observer = dynamic_cast<MarshalObserver*>(_observer.get());
+            if(observer)
+            {
+                observer->reallocated(count);
+            }
+        }
+    }
+
+    void
+    hedged()
+    {
+        if(_observer)
+        {
+            HedgeObserver* observer = dynamic_cast<HedgeObserver*>(_observer.get());
+            if(observer)
+            {
+                observer->hedged();
+            }
+        }
+    }
+
+    void
+    retryBudgetExhausted()
+    {
+        if(_observer)
+        {
+            RetryBudgetObserver* observer = dynamic_cast<RetryBudgetObserver*>(_observer.get());
+            if(observer)
+            {
+                observer->retryBudgetExhausted();
+            }
+        }
+    }
+
 private:
 
     using ObserverHelperT<Ice::Instrumentation::InvocationObserver>::attach;
@@ -26,6 +26,8 @@
 
 #ifndef ICE_CPP11_MAPPING
 #    include <Ice/AsyncResult.h>
+#else
+#    include <condition_variable>
 #endif
 
 #include <exception>
@@ -35,6 +37,8 @@ namespace IceInternal
 
 class RetryException;
 class CollocatedRequestHandler;
+class HedgedInvocation;
+class HedgedRequest;
 
 class ICE_API OutgoingAsyncCompletionCallback
 {
@@ -229,16 +233,25 @@ protected:
     bool exceptionImpl(const Ice::Exception&);
     bool responseImpl(bool);
 
+    int checkRetry(const Ice::Exception&);
+
+    void loadSent(const Ice::ConnectionIPtr&);
+    void loadCompleted(bool);
+
     virtual void runTimerTask();
 
     const Ice::ObjectPrxPtr _proxy;
     RequestHandlerPtr _handler;
     Ice::OperationMode _mode;
+    IceUtil::Time _deadline;
 
 private:
 
     int _cnt;
     bool _sent;
+
+    Ice::ConnectionIPtr _loadConnection;
+    IceUtil::Time _loadSentTime;
 };
 
 //
@@ -300,6 +313,12 @@ protected:
 #endif
 
     bool _synchronous;
+    bool _batchTwowayQueued;
+
+private:
+
+    friend class HedgedInvocation;
+    friend class HedgedRequest;
 };
 
 //
@@ -720,6 +739,143 @@ public:
     }
 };
 
+//
+// Completion callback for synchronous invocations. The thread which
+// receives the reply only wakes up the calling thread, the results are
+// read (or the exception thrown) by the calling thread once it returns
+// from wait(). Unlike PromiseOutgoing, no promise, future or response
+// function is allocated for the invocation.
+//
+class SyncInvoke : virtual public OutgoingAsyncCompletionCallback
+{
+protected:
+
+    SyncInvoke() :
+        _done(false)
+    {
+    }
+
+    std::condition_variable _cv;
+    bool _done;
+
+private:
+
+    virtual bool handleSent(bool done, bool) override
+    {
+        if(done)
+        {
+            complete();
+        }
+        return false;
+    }
+
+    virtual bool handleException(const Ice::Exception&) override
+    {
+        complete();
+        return false;
+    }
+
+    virtual bool handleResponse(bool) override
+    {
+        complete();
+        return false;
+    }
+
+    virtual void handleInvokeSent(bool, OutgoingAsyncBase*) const override
+    {
+        assert(false);
+    }
+
+    virtual void handleInvokeException(const Ice::Exception&, OutgoingAsyncBase*) const override
+    {
+        assert(false);
+    }
+
+    virtual void handleInvokeResponse(bool, OutgoingAsyncBase*) const override
+    {
+        assert(false);
+    }
+
+    //
+    // Called with the OutgoingAsyncBase mutex locked.
+    //
+    void complete()
+    {
+        _done = true;
+        _cv.notify_all();
+    }
+};
+
+template<typename R>
+class SyncOutgoing : public OutgoingAsyncT<R>, public SyncInvoke
+{
+public:
+
+    SyncOutgoing(const std::shared_ptr<Ice::ObjectPrx>& proxy) :
+        OutgoingAsyncT<R>(proxy, true)
+    {
+    }
+
+    R wait()
+    {
+        {
+            std::unique_lock<std::mutex> lock(this->_m);
+            _cv.wait(lock, [this] { return _done; });
+        }
+
+        if(this->_ex)
+        {
+            this->_ex->ice_throw();
+        }
+        if(!(this->_state & this->OK))
+        {
+            this->throwUserException();
+        }
+        assert(this->_read);
+        this->_is.startEncapsulation();
+        R v = this->_read(&this->_is);
+        this->_is.endEncapsulation();
+        return v;
+    }
+};
+
+template<>
+class SyncOutgoing<void> : public OutgoingAsyncT<void>, public SyncInvoke
+{
+public:
+
+    SyncOutgoing(const std::shared_ptr<Ice::ObjectPrx>& proxy) :
+        OutgoingAsyncT<void>(proxy, true)
+    {
+    }
+
+    void wait()
+    {
+        {
+            std::unique_lock<std::mutex> lock(_m);
+            _cv.wait(lock, [this] { return _done; });
+        }
+
+        if(_ex)
+        {
+            _ex->ice_throw();
+        }
+        if(_is.b.empty())
+        {
+            //
+            // No response for oneway and batch-oneway proxies, the
+            // invocation completed once sent.
+            //
+            return;
+        }
+        if(!(_state & OK))
+        {
+            throwUserException();
+        }
+        _is.skipEmptyEncapsulation();
+    }
+};
+
 #else
 
 //
@@ -98,6 +98,19 @@ public:
         b.resize(sz);
     }
 
+    //
+    // Ensures the stream can hold at least sz bytes without having to
+    // reallocate its buffer. This is typically called with the current
+    // position plus the wireSizeEstimate() of the data to marshal.
+    //
+    void reserve(Container::size_type sz)
+    {
+        if(sz > b.capacity())
+        {
+            b.reserve(sz);
+        }
+    }
+
     void startValue(const SlicedDataPtr& data)
     {
         assert(_currentEncaps && _currentEncaps->encoder);
@@ -28,6 +28,7 @@
 #include <Ice/Current.h>
 #include <Ice/CommunicatorF.h>
 #include <Ice/OutgoingAsync.h>
+#include <Ice/Coroutine.h>
 #include <Ice/LocalException.h>
 #include <iosfwd>
 
@@ -36,6 +37,8 @@ namespace Ice
 
 ICE_API extern const Context noExplicitContext;
 
+class ObjectAdapterI;
+
 }
 
 #ifdef ICE_CPP11_MAPPING // C++11 mapping
@@ -224,6 +227,41 @@ public:
     }
 };
 
+//
+// A synchronous invocation on a collocated servant, dispatched from the
+// calling thread without marshaling the parameters. The servant is null
+// if the invocation can't be dispatched directly, the invocation is then
+// sent through the request handler of the proxy.
+//
+class ICE_API DirectDispatch
+{
+public:
+
+    DirectDispatch(::Ice::ObjectPrx*, const char*, ::Ice::OperationMode, const ::Ice::Context&);
+    ~DirectDispatch();
+
+    ::Ice::Object* getServant() const { return _servant.get(); }
+    const ::Ice::Current& getCurrent() const { return _current; }
+
+    //
+    // Must be called from a catch block, throws the exception the caller
+    // would receive if the request was dispatched by the object adapter.
+    //
+    void handleException(const ::std::function<void(const ::Ice::UserException&)>&) const;
+
+private:
+
+    DirectDispatch(const DirectDispatch&) = delete;
+    DirectDispatch& operator=(const DirectDispatch&) = delete;
+
+    void warning(const ::std::string&) const;
+
+    ::Ice::ObjectPrx* _proxy;
+    ::Ice::ObjectAdapterI* _adapter;
+    ::std::shared_ptr<::Ice::Object> _servant;
+    ::Ice::Current _current;
+};
+
 }
 
 namespace Ice
@@ -254,7 +292,7 @@ public:
     bool
     ice_isA(const ::std::string& typeId, const ::Ice::Context& ctx = ::Ice::noExplicitContext)
     {
-        return makePromiseOutgoing<bool>(true, this, &ObjectPrx::__ice_isA, typeId, ctx).get();
+        return makeSyncOutgoing<bool>(this, &ObjectPrx::__ice_isA, typeId, ctx);
     }
 
     ::std::function<void()>
@@ -280,7 +318,7 @@ public:
     void
     ice_ping(const ::Ice::Context& ctx = ::Ice::noExplicitContext)
     {
-        makePromiseOutgoing<void>(true, this, &ObjectPrx::__ice_ping, ctx).get();
+        makeSyncOutgoing<void>(this, &ObjectPrx::__ice_ping, ctx);
     }
 
     ::std::function<void()>
@@ -305,7 +343,7 @@ public:
     ::std::vector<::std::string>
     ice_ids(const ::Ice::Context& ctx = ::Ice::noExplicitContext)
     {
-        return makePromiseOutgoing<::std::vector<::std::string>>(true, this, &ObjectPrx::__ice_ids, ctx).get();
+        return makeSyncOutgoing<::std::vector<::std::string>>(this, &ObjectPrx::__ice_ids, ctx);
     }
 
     ::std::function<void()>
@@ -330,7 +368,7 @@ public:
     ::std::string
     ice_id(const ::Ice::Context& ctx = ::Ice::noExplicitContext)
     {
-        return makePromiseOutgoing<::std::string>(true, this, &ObjectPrx::__ice_id, ctx).get();
+        return makeSyncOutgoing<::std::string>(this, &ObjectPrx::__ice_id, ctx);
     }
 
     ::std::function<void()>
@@ -511,8 +549,18 @@ public:
     ::Ice::Int ice_getInvocationTimeout() const;
     ::std::shared_ptr<::Ice::ObjectPrx> ice_invocationTimeout(::Ice::Int) const;
 
+    ::Ice::Int ice_getHedgeDelay() const;
+    ::Ice::Int ice_getHedgeMax() const;
+    ::std::shared_ptr<::Ice::ObjectPrx> ice_hedge(::Ice::Int, ::Ice::Int) const;
+
+    ::Ice::Int ice_getBatchAutoFlushSize() const;
+    ::Ice::Int ice_getBatchAutoFlushDelay() const;
+    ::std::shared_ptr<::Ice::ObjectPrx> ice_batchAutoFlush(::Ice::Int, ::Ice::Int) const;
+
     ::std::shared_ptr<::Ice::ObjectPrx> ice_twoway() const;
     bool ice_isTwoway() const;
+    ::std::shared_ptr<::Ice::ObjectPrx> ice_batchTwoway() const;
+    bool ice_isBatchTwoway() const;
     ::std::shared_ptr<::Ice::ObjectPrx> ice_oneway() const;
     bool ice_isOneway() const;
     ::std::shared_ptr<::Ice::ObjectPrx> ice_batchOneway() const;
@@ -613,6 +661,14 @@ protected:
         return outAsync->getFuture();
     }
 
+    template<typename R, typename Obj, typename Fn, typename... Args>
+    R makeSyncOutgoing(Obj obj, Fn fn, Args&&... args)
+    {
+        auto outAsync = ::std::make_shared<::IceInternal::SyncOutgoing<R>>(shared_from_this());
+        (obj->*fn)(outAsync, std::forward<Args>(args)...);
+        return outAsync->wait();
+    }
+
     template<typename R, typename Re, typename E, typename S, typename Obj, typename Fn, typename... Args>
     ::std::function<void()> makeLambdaOutgoing(Re r, E e, S s, Obj obj, Fn fn, Args&&... args)
     {
@@ -621,6 +677,37 @@ protected:
         return [outAsync]() { outAsync->cancel(); };
     }
 
+    template<typename S, typename Fn>
+    bool makeDirectCall(const char* operation, ::Ice::OperationMode mode, const ::Ice::Context& ctx,
+                        const ::std::function<void(const ::Ice::UserException&)>& userException, Fn fn)
+    {
+        ::IceInternal::DirectDispatch dispatch(this, operation, mode, ctx);
+        S* servant = dynamic_cast<S*>(dispatch.getServant());
+        if(!servant)
+        {
+            return false;
+        }
+        try
+        {
+            fn(servant, dispatch.getCurrent());
+        }
+        catch(...)
+        {
+            dispatch.handleException(userException);
+        }
+        return true;
+    }
+
+#ifdef ICE_COROUTINES
+    template<typename R, typename Obj, typename Fn, typename... Args>
+    ::Ice::Awaitable<R> makeCoroutineOutgoing(Obj obj, Fn fn, Args&&... args)
+    {
+        auto outAsync = ::std::make_shared<::IceInternal::CoroutineOutgoing<R>>(shared_from_this());
+        (obj->*fn)(outAsync, std::forward<Args>(args)...);
+        return ::Ice::Awaitable<R>(outAsync);
+    }
+#endif
+
     virtual ::std::shared_ptr<ObjectPrx> __newInstance() const;
     ObjectPrx() = default;
     friend ::std::shared_ptr<ObjectPrx> IceInternal::createProxy<ObjectPrx>();
@@ -725,11 +812,26 @@ public:
         return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_invocationTimeout(timeout));
     }
 
+    ::std::shared_ptr<Prx> ice_hedge(int delay, int max) const
+    {
+        return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_hedge(delay, max));
+    }
+
+    ::std::shared_ptr<Prx> ice_batchAutoFlush(int size, int delay) const
+    {
+        return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_batchAutoFlush(size, delay));
+    }
+
     ::std::shared_ptr<Prx> ice_twoway() const
     {
         return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_twoway());
     }
 
+    ::std::shared_ptr<Prx> ice_batchTwoway() const
+    {
+        return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_batchTwoway());
+    }
+
     ::std::shared_ptr<Prx> ice_oneway() const
     {
         return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_oneway());
@@ -1295,8 +1397,18 @@ public:
     ::Ice::Int ice_getInvocationTimeout() const;
     ::Ice::ObjectPrx ice_invocationTimeout(::Ice::Int) const;
 
+    ::Ice::Int ice_getHedgeDelay() const;
+    ::Ice::Int ice_getHedgeMax() const;
+    ::Ice::ObjectPrx ice_hedge(::Ice::Int, ::Ice::Int) const;
+
+    ::Ice::Int ice_getBatchAutoFlushSize() const;
+    ::Ice::Int ice_getBatchAutoFlushDelay() const;
+    ::Ice::ObjectPrx ice_batchAutoFlush(::Ice::Int, ::Ice::Int) const;
+
     ::Ice::ObjectPrx ice_twoway() const;
     bool ice_isTwoway() const;
+    ::Ice::ObjectPrx ice_batchTwoway() const;
+    bool ice_isBatchTwoway() const;
     ::Ice::ObjectPrx ice_oneway() const;
     bool ice_isOneway() const;
     ::Ice::ObjectPrx ice_batchOneway() const;
@@ -1512,11 +1624,26 @@ public:
         return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_invocationTimeout(timeout).get());
     }
 
+    IceInternal::ProxyHandle<Prx> ice_hedge(int delay, int max) const
+    {
+        return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_hedge(delay, max).get());
+    }
+
+    IceInternal::ProxyHandle<Prx> ice_batchAutoFlush(int size, int delay) const
+    {
+        return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_batchAutoFlush(size, delay).get());
+    }
+
     IceInternal::ProxyHandle<Prx> ice_twoway() const
     {
         return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_twoway().get());
     }
 
+    IceInternal::ProxyHandle<Prx> ice_batchTwoway() const
+    {
+        return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_batchTwoway().get());
+    }
+
     IceInternal::ProxyHandle<Prx> ice_oneway() const
     {
         return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_oneway().get());
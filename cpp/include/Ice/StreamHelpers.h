@@ -11,6 +11,7 @@
 #define ICE_STREAM_HELPERS_H
 
 #include <Ice/ObjectF.h>
+#include <IceUtil/FlatMap.h>
 
 #ifndef ICE_CPP11_MAPPING
 #   include <IceUtil/ScopedArray.h>
@@ -94,6 +95,23 @@ struct IsMap
     static const bool value = IsContainer<T>::value && sizeof(test<T>(0)) == sizeof(char);
 };
 
+//
+// Is the provided type a hashed map such as std::unordered_map?
+// For now, the implementation only checks if there is a T::hasher typedef
+// using SFINAE
+//
+template<typename T>
+struct IsHashedMap
+{
+    template<typename C>
+    static char test(typename C::hasher*);
+
+    template<typename C>
+    static long test(...);
+
+    static const bool value = IsMap<T>::value && sizeof(test<T>(0)) == sizeof(char);
+};
+
 #ifdef ICE_CPP11_MAPPING
 
 //
@@ -538,6 +556,34 @@ struct StreamHelper<std::pair<IceUtil::ScopedArray<T>, std::pair<const T*, const
 #endif
 
 
+//
+// Reads the size of a dictionary, and sizes the buckets of hashed maps
+// (std::unordered_map) once for all the elements instead of rehashing as
+// the map grows.
+//
+template<typename T, bool hashed>
+struct DictionarySizeHelper
+{
+    template<class S> static inline Int
+    read(S* stream, T&)
+    {
+        return stream->readSize();
+    }
+};
+
+template<typename T>
+struct DictionarySizeHelper<T, true>
+{
+    template<class S> static inline Int
+    read(S* stream, T& v)
+    {
+        Int sz = stream->readAndCheckSeqSize(StreamableTraits<typename T::key_type>::minWireSize +
+                                             StreamableTraits<typename T::mapped_type>::minWireSize);
+        v.rehash(static_cast<typename T::size_type>(sz / v.max_load_factor()) + 1);
+        return sz;
+    }
+};
+
 // Helper for dictionaries
 template<typename T>
 struct StreamHelper<T, StreamHelperCategoryDictionary>
@@ -556,8 +602,13 @@ struct StreamHelper<T, StreamHelperCategoryDictionary>
     template<class S> static inline void
     read(S* stream, T& v)
     {
-        Int sz = stream->readSize();
         v.clear();
+        Int sz = DictionarySizeHelper<T, IsHashedMap<T>::value>::read(stream, v);
+
+        //
+        // Dictionaries are marshaled in key order by the std::map mapping,
+        // so for ordered maps the end hint makes each insertion constant time.
+        //
         while(sz--)
         {
             typename T::value_type p;
@@ -568,6 +619,40 @@ struct StreamHelper<T, StreamHelperCategoryDictionary>
     }
 };
 
+// Helper for dictionaries mapped to IceUtil::FlatMap (cpp:type:flat_map)
+template<typename K, typename V, typename C>
+struct StreamHelper<IceUtil::FlatMap<K, V, C>, StreamHelperCategoryDictionary>
+{
+    template<class S> static inline void
+    write(S* stream, const IceUtil::FlatMap<K, V, C>& v)
+    {
+        stream->writeSize(static_cast<Int>(v.size()));
+        for(typename IceUtil::FlatMap<K, V, C>::const_iterator p = v.begin(); p != v.end(); ++p)
+        {
+            stream->write(p->first);
+            stream->write(p->second);
+        }
+    }
+
+    template<class S> static inline void
+    read(S* stream, IceUtil::FlatMap<K, V, C>& v)
+    {
+        //
+        // Unmarshal all the elements in a single vector and hand it over to
+        // the map, which only sorts it if the elements were not marshaled in
+        // key order.
+        //
+        Int sz = stream->readAndCheckSeqSize(StreamableTraits<K>::minWireSize + StreamableTraits<V>::minWireSize);
+        typename IceUtil::FlatMap<K, V, C>::container_type elements(static_cast<size_t>(sz));
+        for(typename IceUtil::FlatMap<K, V, C>::iterator p = elements.begin(); p != elements.end(); ++p)
+        {
+            stream->read(p->first);
+            stream->read(p->second);
+        }
+        v.adopt(elements);
+    }
+};
+
 // Helper for user exceptions
 template<typename T>
 struct StreamHelper<T, StreamHelperCategoryUserException>
@@ -616,6 +701,264 @@ struct StreamHelper<T, StreamHelperCategoryClass>
 };
 
 
+//
+// Helpers to estimate the number of bytes needed to marshal a value,
+// used to pre-size the marshaling buffer with OutputStream::reserve.
+// The estimate is exact for fixed-length types, strings, sequences and
+// dictionaries of such types; it's the minimum wire size for classes
+// and proxies.
+//
+
+template<typename T> Int wireSizeEstimate(const T&);
+
+inline Int
+wireSizeEstimateSize(size_t sz)
+{
+    return sz < 255 ? 1 : 5;
+}
+
+// Base helper: the minimum wire size of the type
+template<typename T, StreamHelperCategory st>
+struct StreamSizeHelper
+{
+    static inline Int
+    estimate(const T&)
+    {
+        return StreamableTraits<T>::minWireSize;
+    }
+};
+
+template<>
+struct StreamSizeHelper< ::std::string, StreamHelperCategoryBuiltin>
+{
+    static inline Int
+    estimate(const ::std::string& v)
+    {
+        return wireSizeEstimateSize(v.size()) + static_cast<Int>(v.size());
+    }
+};
+
+template<>
+struct StreamSizeHelper< ::std::wstring, StreamHelperCategoryBuiltin>
+{
+    static inline Int
+    estimate(const ::std::wstring& v)
+    {
+        return wireSizeEstimateSize(v.size()) + static_cast<Int>(v.size());
+    }
+};
+
+template<>
+struct StreamSizeHelper< ::std::vector<bool>, StreamHelperCategoryBuiltin>
+{
+    static inline Int
+    estimate(const ::std::vector<bool>& v)
+    {
+        return wireSizeEstimateSize(v.size()) + static_cast<Int>(v.size());
+    }
+};
+
+//
+// "helper" for the StreamSizeHelper<T, StreamHelperCategoryStruct[Class]> below.
+// The C++11 mapping adds the estimates of the struct data members returned
+// by ice_tuple(), slice2cpp generates specializations for C++98 structs.
+//
+#ifdef ICE_CPP11_MAPPING
+
+template<size_t I = 0, typename... Te>
+typename std::enable_if<I == sizeof...(Te), Int>::type
+wireSizeEstimateAll(const std::tuple<Te...>&)
+{
+    return 0;
+}
+
+template<size_t I = 0, typename... Te>
+typename std::enable_if<I < sizeof...(Te), Int>::type
+wireSizeEstimateAll(const std::tuple<Te...>& tuple)
+{
+    return wireSizeEstimate(std::get<I>(tuple)) + wireSizeEstimateAll<I + 1, Te...>(tuple);
+}
+
+#endif
+
+template<typename T>
+struct StreamSizeEstimator
+{
+    static inline Int
+    estimate(const T& v)
+    {
+#ifdef ICE_CPP11_MAPPING
+        return wireSizeEstimateAll(v.ice_tuple());
+#else
+        return StreamableTraits<T>::minWireSize;
+#endif
+    }
+};
+
+// Helper for structs
+template<typename T>
+struct StreamSizeHelper<T, StreamHelperCategoryStruct>
+{
+    static inline Int
+    estimate(const T& v)
+    {
+        if(StreamableTraits<T>::fixedLength)
+        {
+            return StreamableTraits<T>::minWireSize;
+        }
+        return StreamSizeEstimator<T>::estimate(v);
+    }
+};
+
+// Helper for class structs
+template<typename T>
+struct StreamSizeHelper<T, StreamHelperCategoryStructClass>
+{
+    static inline Int
+    estimate(const T& v)
+    {
+        if(StreamableTraits<T>::fixedLength || !v)
+        {
+            return StreamableTraits<T>::minWireSize;
+        }
+        return StreamSizeEstimator<T>::estimate(v);
+    }
+};
+
+//
+// Helpers for sequences and dictionaries. Only standard-like containers
+// are inspected, custom sequence types with their own StreamHelper are
+// estimated with their minimum wire size.
+//
+template<typename T, StreamHelperCategory st, bool isContainer>
+struct StreamSizeContainerHelper
+{
+    static inline Int
+    estimate(const T&)
+    {
+        return StreamableTraits<T>::minWireSize;
+    }
+};
+
+template<typename T>
+struct StreamSizeContainerHelper<T, StreamHelperCategorySequence, true>
+{
+    static inline Int
+    estimate(const T& v)
+    {
+        typedef typename T::value_type E;
+        Int sz = wireSizeEstimateSize(v.size());
+        if(StreamableTraits<E>::fixedLength)
+        {
+            sz += static_cast<Int>(v.size()) * StreamableTraits<E>::minWireSize;
+        }
+        else
+        {
+            for(typename T::const_iterator p = v.begin(); p != v.end(); ++p)
+            {
+                sz += wireSizeEstimate(*p);
+            }
+        }
+        return sz;
+    }
+};
+
+template<typename T>
+struct StreamSizeContainerHelper<T, StreamHelperCategoryDictionary, true>
+{
+    static inline Int
+    estimate(const T& v)
+    {
+        typedef typename T::key_type K;
+        typedef typename T::mapped_type V;
+        Int sz = wireSizeEstimateSize(v.size());
+        if(StreamableTraits<K>::fixedLength && StreamableTraits<V>::fixedLength)
+        {
+            sz += static_cast<Int>(v.size()) * (StreamableTraits<K>::minWireSize + StreamableTraits<V>::minWireSize);
+        }
+        else
+        {
+            for(typename T::const_iterator p = v.begin(); p != v.end(); ++p)
+            {
+                sz += wireSizeEstimate(p->first) + wireSizeEstimate(p->second);
+            }
+        }
+        return sz;
+    }
+};
+
+// Helper for sequences
+template<typename T>
+struct StreamSizeHelper<T, StreamHelperCategorySequence>
+{
+    static inline Int
+    estimate(const T& v)
+    {
+        return StreamSizeContainerHelper<T, StreamHelperCategorySequence, IsContainer<T>::value>::estimate(v);
+    }
+};
+
+// Helper for dictionaries
+template<typename T>
+struct StreamSizeHelper<T, StreamHelperCategoryDictionary>
+{
+    static inline Int
+    estimate(const T& v)
+    {
+        return StreamSizeContainerHelper<T, StreamHelperCategoryDictionary, IsMap<T>::value>::estimate(v);
+    }
+};
+
+// Helper for array custom sequence parameters
+template<typename T>
+struct StreamSizeHelper<std::pair<const T*, const T*>, StreamHelperCategorySequence>
+{
+    static inline Int
+    estimate(const std::pair<const T*, const T*>& v)
+    {
+        Int sz = wireSizeEstimateSize(static_cast<size_t>(v.second - v.first));
+        if(StreamableTraits<T>::fixedLength)
+        {
+            sz += static_cast<Int>(v.second - v.first) * StreamableTraits<T>::minWireSize;
+        }
+        else
+        {
+            for(const T* p = v.first; p != v.second; ++p)
+            {
+                sz += wireSizeEstimate(*p);
+            }
+        }
+        return sz;
+    }
+};
+
+#ifndef ICE_CPP11_MAPPING
+
+// Helper for range custom sequence parameters
+template<typename T>
+struct StreamSizeHelper<std::pair<T, T>, StreamHelperCategorySequence>
+{
+    static inline Int
+    estimate(const std::pair<T, T>& v)
+    {
+        Int sz = 0;
+        size_t n = 0;
+        for(T p = v.first; p != v.second; ++p, ++n)
+        {
+            sz += wireSizeEstimate(*p);
+        }
+        return wireSizeEstimateSize(n) + sz;
+    }
+};
+
+#endif
+
+template<typename T> inline Int
+wireSizeEstimate(const T& v)
+{
+    return StreamSizeHelper<T, StreamableTraits<T>::helper>::estimate(v);
+}
+
 //
 // Helpers to read/write optional attributes or members.
 //
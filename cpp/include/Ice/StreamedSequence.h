@@ -0,0 +1,358 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_STREAMED_SEQUENCE_H
+#define ICE_STREAMED_SEQUENCE_H
+
+#include <Ice/InputStream.h>
+#include <Ice/OutputStream.h>
+#include <Ice/LocalException.h>
+#include <IceUtil/UniquePtr.h>
+#include <iterator>
+
+#ifdef ICE_CPP11_MAPPING
+#   include <functional>
+#endif
+
+namespace Ice
+{
+
+//
+// Writes the elements of a streamed sequence directly into the request
+// stream. The producer must write exactly the number of elements given
+// to the StreamedSequence.
+//
+template<typename T>
+class SequenceOutput : private IceUtil::noncopyable
+{
+public:
+
+    SequenceOutput(OutputStream* stream, Int size) :
+        _stream(stream),
+        _remaining(size)
+    {
+    }
+
+    void write(const T& v)
+    {
+        if(_remaining == 0)
+        {
+            throw MarshalException(__FILE__, __LINE__, "too many elements written to streamed sequence");
+        }
+        _stream->write(v);
+        --_remaining;
+    }
+
+    Int remaining() const
+    {
+        return _remaining;
+    }
+
+private:
+
+    OutputStream* _stream;
+    Int _remaining;
+};
+
+template<typename T>
+class SequenceProducer
+{
+public:
+
+    virtual ~SequenceProducer()
+    {
+    }
+
+    virtual void produce(SequenceOutput<T>&) = 0;
+};
+
+//
+// Mapping for sequence in-parameters with the cpp:stream metadata.
+//
+// The caller provides the number of elements and a producer, which is
+// called to write the elements when the request is marshaled, so the
+// sequence is never materialized on the client side. The servant iterates
+// over the elements, which are unmarshaled on demand from the request
+// buffer; the sequence must not be used after the dispatch returns.
+//
+template<typename T>
+class StreamedSequence
+{
+public:
+
+    class const_iterator
+    {
+    public:
+
+        typedef std::input_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        const_iterator() :
+            _stream(0),
+            _remaining(0)
+        {
+        }
+
+        reference operator*() const
+        {
+            return _value;
+        }
+
+        pointer operator->() const
+        {
+            return &_value;
+        }
+
+        const_iterator& operator++()
+        {
+            next();
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator tmp(*this);
+            next();
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& rhs) const
+        {
+            return _remaining == rhs._remaining;
+        }
+
+        bool operator!=(const const_iterator& rhs) const
+        {
+            return _remaining != rhs._remaining;
+        }
+
+    private:
+
+        friend class StreamedSequence;
+
+        const_iterator(InputStream* stream, Int size) :
+            _stream(stream),
+            _remaining(size + 1)
+        {
+            next();
+        }
+
+        void next()
+        {
+            if(--_remaining > 0)
+            {
+                _stream->read(_value);
+            }
+        }
+
+        InputStream* _stream;
+        Int _remaining; // Elements left, including the current one
+        T _value;
+    };
+
+    StreamedSequence() :
+        _size(0),
+        _producer(0),
+        _instance(0),
+        _begin(0),
+        _end(0)
+    {
+    }
+
+    StreamedSequence(Int size, SequenceProducer<T>& producer) :
+        _size(size),
+        _producer(&producer),
+        _instance(0),
+        _begin(0),
+        _end(0)
+    {
+    }
+
+#ifdef ICE_CPP11_MAPPING
+    StreamedSequence(Int size, std::function<void(SequenceOutput<T>&)> producer) :
+        _size(size),
+        _producer(0),
+        _produce(std::move(producer)),
+        _instance(0),
+        _begin(0),
+        _end(0)
+    {
+    }
+#endif
+
+    StreamedSequence(const StreamedSequence& other) :
+        _size(other._size),
+        _producer(other._producer),
+#ifdef ICE_CPP11_MAPPING
+        _produce(other._produce),
+#endif
+        _instance(other._instance),
+        _encoding(other._encoding),
+        _begin(other._begin),
+        _end(other._end)
+    {
+    }
+
+    StreamedSequence& operator=(const StreamedSequence& other)
+    {
+        if(this != &other)
+        {
+            _size = other._size;
+            _producer = other._producer;
+#ifdef ICE_CPP11_MAPPING
+            _produce = other._produce;
+#endif
+            _instance = other._instance;
+            _encoding = other._encoding;
+            _begin = other._begin;
+            _end = other._end;
+            _stream.reset();
+        }
+        return *this;
+    }
+
+    Int size() const
+    {
+        return _size;
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    //
+    // Each call to begin() restarts the unmarshaling of the elements and
+    // invalidates the iterators previously returned.
+    //
+    const_iterator begin() const
+    {
+        if(!_stream.get())
+        {
+            IceInternal::Buffer buf(_begin, _end);
+            if(_instance)
+            {
+                _stream.reset(new InputStream(_instance, _encoding, buf));
+            }
+            else
+            {
+                _stream.reset(new InputStream(_encoding, buf));
+            }
+        }
+        _stream->i = _stream->b.begin();
+        return const_iterator(_stream.get(), _size);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator();
+    }
+
+    void __write(OutputStream* stream) const
+    {
+        stream->writeSize(_size);
+        SequenceOutput<T> out(stream, _size);
+#ifdef ICE_CPP11_MAPPING
+        if(_produce)
+        {
+            _produce(out);
+        }
+        else
+#endif
+        if(_producer)
+        {
+            _producer->produce(out);
+        }
+        if(out.remaining() != 0)
+        {
+            throw MarshalException(__FILE__, __LINE__, "too few elements written to streamed sequence");
+        }
+    }
+
+    void __read(InputStream* stream)
+    {
+        _size = stream->readAndCheckSeqSize(StreamableTraits<T>::minWireSize);
+        _instance = stream->instance();
+        _encoding = stream->getEncoding();
+        _begin = stream->i;
+
+        //
+        // Skip the elements, the parameters following the sequence must be
+        // unmarshaled before the dispatch.
+        //
+        if(StreamableTraits<T>::fixedLength)
+        {
+            stream->skip(static_cast<InputStream::size_type>(_size) * StreamableTraits<T>::minWireSize);
+        }
+        else
+        {
+            T v;
+            for(Int i = 0; i < _size; ++i)
+            {
+                stream->read(v);
+            }
+        }
+        _end = stream->i;
+        _stream.reset();
+    }
+
+private:
+
+    Int _size;
+    SequenceProducer<T>* _producer;
+#ifdef ICE_CPP11_MAPPING
+    std::function<void(SequenceOutput<T>&)> _produce;
+#endif
+    IceInternal::Instance* _instance;
+    EncodingVersion _encoding;
+    const Byte* _begin;
+    const Byte* _end;
+    mutable IceUtil::UniquePtr<InputStream> _stream;
+};
+
+template<typename T>
+struct StreamableTraits< StreamedSequence<T> >
+{
+    static const StreamHelperCategory helper = StreamHelperCategorySequence;
+    static const int minWireSize = 1;
+    static const bool fixedLength = false;
+};
+
+template<typename T>
+struct StreamHelper<StreamedSequence<T>, StreamHelperCategorySequence>
+{
+    template<class S> static inline void
+    write(S* stream, const StreamedSequence<T>& v)
+    {
+        v.__write(stream);
+    }
+
+    template<class S> static inline void
+    read(S* stream, StreamedSequence<T>& v)
+    {
+        v.__read(stream);
+    }
+};
+
+template<typename T>
+struct StreamSizeHelper<StreamedSequence<T>, StreamHelperCategorySequence>
+{
+    static inline Int
+    estimate(const StreamedSequence<T>& v)
+    {
+        return wireSizeEstimateSize(v.size()) + v.size() * StreamableTraits<T>::minWireSize;
+    }
+};
+
+}
+
+#endif
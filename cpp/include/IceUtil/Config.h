@@ -125,6 +125,14 @@
 #   define ICE_NOEXCEPT_FALSE /**/
 #endif
 
+//
+// Does the C++ compiler support C++20 coroutines? The coroutine (co_await)
+// API is only provided with the C++11 mapping.
+//
+#if defined(ICE_CPP11_MAPPING) && defined(__cpp_impl_coroutine)
+#   define ICE_COROUTINES
+#endif
+
 
 //
 // Does the C++ compiler library provide std::codecvt_utf8 and
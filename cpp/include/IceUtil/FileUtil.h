@@ -131,6 +131,67 @@ private:
 
 typedef IceUtil::Handle<FileLock> FileLockPtr;
 
+//
+// Memory mapping of a file, used to marshal or unmarshal large files
+// without copying them into the heap. Errors are reported with
+// IceUtil::SyscallException.
+//
+class ICE_API MappedFile : public IceUtil::Shared, public IceUtil::noncopyable
+{
+public:
+
+    //
+    // Maps the given file read-only.
+    //
+    MappedFile(const std::string&);
+
+    //
+    // Creates or truncates the given file to the given size and maps
+    // it read-write. Call finish() once the data is written.
+    //
+    MappedFile(const std::string&, size_t);
+
+    virtual ~MappedFile();
+
+    const unsigned char* begin() const
+    {
+        return _begin;
+    }
+
+    const unsigned char* end() const
+    {
+        return _begin + _size;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    //
+    // Unmaps a read-write mapping and sets the file contents to the
+    // given data. If the data is at the beginning of the mapping the
+    // file is just truncated, otherwise the data is written to the file.
+    //
+    void finish(const std::pair<const unsigned char*, const unsigned char*>&);
+
+private:
+
+    void unmap();
+
+#ifdef _WIN32
+    HANDLE _fd;
+    HANDLE _mapping;
+#else
+    int _fd;
+#endif
+    unsigned char* _begin;
+    size_t _size;
+    std::string _path;
+};
+
+typedef IceUtil::Handle<MappedFile> MappedFilePtr;
+
 //
 // Use streamFilename to construct the filename given to std stream classes
 // like ifstream and ofstream.
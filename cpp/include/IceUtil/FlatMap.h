@@ -0,0 +1,440 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_UTIL_FLAT_MAP_H
+#define ICE_UTIL_FLAT_MAP_H
+
+#include <IceUtil/Config.h>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace IceUtil
+{
+
+//
+// An associative container with the std::map interface, which keeps its
+// elements sorted by key in a contiguous std::vector. Lookups are binary
+// searches over contiguous memory, and inserting elements in key order is
+// as cheap as appending to the vector. Insertions in the middle and
+// erasures are linear in the size of the map.
+//
+// This is the container used for dictionaries with the cpp:type:flat_map
+// metadata.
+//
+template<typename K, typename V, typename Compare = std::less<K> >
+class FlatMap
+{
+public:
+
+    typedef K key_type;
+    typedef V mapped_type;
+    typedef std::pair<K, V> value_type;
+    typedef Compare key_compare;
+    typedef std::vector<value_type> container_type;
+    typedef typename container_type::size_type size_type;
+    typedef typename container_type::difference_type difference_type;
+    typedef typename container_type::reference reference;
+    typedef typename container_type::const_reference const_reference;
+    typedef typename container_type::pointer pointer;
+    typedef typename container_type::const_pointer const_pointer;
+    typedef typename container_type::iterator iterator;
+    typedef typename container_type::const_iterator const_iterator;
+    typedef typename container_type::reverse_iterator reverse_iterator;
+    typedef typename container_type::const_reverse_iterator const_reverse_iterator;
+
+    class value_compare
+    {
+    public:
+
+        bool operator()(const value_type& lhs, const value_type& rhs) const
+        {
+            return _comp(lhs.first, rhs.first);
+        }
+
+    private:
+
+        friend class FlatMap;
+
+        value_compare(const Compare& comp) :
+            _comp(comp)
+        {
+        }
+
+        Compare _comp;
+    };
+
+    FlatMap()
+    {
+    }
+
+    explicit FlatMap(const Compare& comp) :
+        _comp(comp)
+    {
+    }
+
+    template<typename InputIterator>
+    FlatMap(InputIterator first, InputIterator last, const Compare& comp = Compare()) :
+        _elements(first, last),
+        _comp(comp)
+    {
+        normalize();
+    }
+
+    iterator begin()
+    {
+        return _elements.begin();
+    }
+
+    const_iterator begin() const
+    {
+        return _elements.begin();
+    }
+
+    iterator end()
+    {
+        return _elements.end();
+    }
+
+    const_iterator end() const
+    {
+        return _elements.end();
+    }
+
+    reverse_iterator rbegin()
+    {
+        return _elements.rbegin();
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+        return _elements.rbegin();
+    }
+
+    reverse_iterator rend()
+    {
+        return _elements.rend();
+    }
+
+    const_reverse_iterator rend() const
+    {
+        return _elements.rend();
+    }
+
+    bool empty() const
+    {
+        return _elements.empty();
+    }
+
+    size_type size() const
+    {
+        return _elements.size();
+    }
+
+    size_type max_size() const
+    {
+        return _elements.max_size();
+    }
+
+    size_type capacity() const
+    {
+        return _elements.capacity();
+    }
+
+    void reserve(size_type n)
+    {
+        _elements.reserve(n);
+    }
+
+    void clear()
+    {
+        _elements.clear();
+    }
+
+    void swap(FlatMap& other)
+    {
+        _elements.swap(other._elements);
+        std::swap(_comp, other._comp);
+    }
+
+    key_compare key_comp() const
+    {
+        return _comp;
+    }
+
+    value_compare value_comp() const
+    {
+        return value_compare(_comp);
+    }
+
+    mapped_type& operator[](const key_type& key)
+    {
+        iterator p = lower_bound(key);
+        if(p == _elements.end() || _comp(key, p->first))
+        {
+            p = _elements.insert(p, value_type(key, mapped_type()));
+        }
+        return p->second;
+    }
+
+    mapped_type& at(const key_type& key)
+    {
+        iterator p = find(key);
+        if(p == _elements.end())
+        {
+            throw std::out_of_range("IceUtil::FlatMap::at");
+        }
+        return p->second;
+    }
+
+    const mapped_type& at(const key_type& key) const
+    {
+        const_iterator p = find(key);
+        if(p == _elements.end())
+        {
+            throw std::out_of_range("IceUtil::FlatMap::at");
+        }
+        return p->second;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& v)
+    {
+        iterator p = lower_bound(v.first);
+        if(p != _elements.end() && !_comp(v.first, p->first))
+        {
+            return std::pair<iterator, bool>(p, false);
+        }
+        return std::pair<iterator, bool>(_elements.insert(p, v), true);
+    }
+
+    //
+    // Constant time if the element belongs right before the hint, in
+    // particular when appending elements in key order with end() as the
+    // hint.
+    //
+    iterator insert(iterator hint, const value_type& v)
+    {
+        if((hint == _elements.end() || _comp(v.first, hint->first)) &&
+           (hint == _elements.begin() || _comp((hint - 1)->first, v.first)))
+        {
+            return _elements.insert(hint, v);
+        }
+        return insert(v).first;
+    }
+
+    template<typename InputIterator>
+    void insert(InputIterator first, InputIterator last)
+    {
+        for(; first != last; ++first)
+        {
+            insert(_elements.end(), *first);
+        }
+    }
+
+    void erase(iterator p)
+    {
+        _elements.erase(p);
+    }
+
+    void erase(iterator first, iterator last)
+    {
+        _elements.erase(first, last);
+    }
+
+    size_type erase(const key_type& key)
+    {
+        iterator p = find(key);
+        if(p == _elements.end())
+        {
+            return 0;
+        }
+        _elements.erase(p);
+        return 1;
+    }
+
+    iterator find(const key_type& key)
+    {
+        iterator p = lower_bound(key);
+        return p == _elements.end() || _comp(key, p->first) ? _elements.end() : p;
+    }
+
+    const_iterator find(const key_type& key) const
+    {
+        const_iterator p = lower_bound(key);
+        return p == _elements.end() || _comp(key, p->first) ? _elements.end() : p;
+    }
+
+    size_type count(const key_type& key) const
+    {
+        return find(key) == _elements.end() ? 0 : 1;
+    }
+
+    iterator lower_bound(const key_type& key)
+    {
+        return std::lower_bound(_elements.begin(), _elements.end(), key, KeyCompare(_comp));
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+    {
+        return std::lower_bound(_elements.begin(), _elements.end(), key, KeyCompare(_comp));
+    }
+
+    iterator upper_bound(const key_type& key)
+    {
+        return std::upper_bound(_elements.begin(), _elements.end(), key, KeyCompare(_comp));
+    }
+
+    const_iterator upper_bound(const key_type& key) const
+    {
+        return std::upper_bound(_elements.begin(), _elements.end(), key, KeyCompare(_comp));
+    }
+
+    std::pair<iterator, iterator> equal_range(const key_type& key)
+    {
+        iterator p = lower_bound(key);
+        return std::pair<iterator, iterator>(p, p == _elements.end() || _comp(key, p->first) ? p : p + 1);
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+    {
+        const_iterator p = lower_bound(key);
+        return std::pair<const_iterator, const_iterator>(p, p == _elements.end() || _comp(key, p->first) ? p : p + 1);
+    }
+
+    //
+    // Replaces the contents of the map with the given elements, which are
+    // swapped out of the vector. The elements are only sorted if they are
+    // not already in strictly increasing key order; as with insert, the
+    // first element wins when several have the same key.
+    //
+    void adopt(container_type& elements)
+    {
+        _elements.swap(elements);
+        elements.clear();
+        normalize();
+    }
+
+private:
+
+    struct KeyCompare
+    {
+        KeyCompare(const Compare& comp) :
+            _comp(comp)
+        {
+        }
+
+        bool operator()(const value_type& lhs, const key_type& rhs) const
+        {
+            return _comp(lhs.first, rhs);
+        }
+
+        bool operator()(const key_type& lhs, const value_type& rhs) const
+        {
+            return _comp(lhs, rhs.first);
+        }
+
+        const Compare& _comp;
+    };
+
+    struct NotLess
+    {
+        NotLess(const Compare& comp) :
+            _comp(comp)
+        {
+        }
+
+        bool operator()(const value_type& lhs, const value_type& rhs) const
+        {
+            return !_comp(lhs.first, rhs.first);
+        }
+
+        const Compare& _comp;
+    };
+
+    struct Equal
+    {
+        Equal(const Compare& comp) :
+            _comp(comp)
+        {
+        }
+
+        bool operator()(const value_type& lhs, const value_type& rhs) const
+        {
+            return !_comp(lhs.first, rhs.first) && !_comp(rhs.first, lhs.first);
+        }
+
+        const Compare& _comp;
+    };
+
+    void normalize()
+    {
+        if(std::adjacent_find(_elements.begin(), _elements.end(), NotLess(_comp)) != _elements.end())
+        {
+            std::stable_sort(_elements.begin(), _elements.end(), value_compare(_comp));
+            _elements.erase(std::unique(_elements.begin(), _elements.end(), Equal(_comp)), _elements.end());
+        }
+    }
+
+    container_type _elements;
+    Compare _comp;
+};
+
+template<typename K, typename V, typename C>
+inline bool
+operator==(const FlatMap<K, V, C>& lhs, const FlatMap<K, V, C>& rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename K, typename V, typename C>
+inline bool
+operator!=(const FlatMap<K, V, C>& lhs, const FlatMap<K, V, C>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template<typename K, typename V, typename C>
+inline bool
+operator<(const FlatMap<K, V, C>& lhs, const FlatMap<K, V, C>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename K, typename V, typename C>
+inline bool
+operator<=(const FlatMap<K, V, C>& lhs, const FlatMap<K, V, C>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template<typename K, typename V, typename C>
+inline bool
+operator>(const FlatMap<K, V, C>& lhs, const FlatMap<K, V, C>& rhs)
+{
+    return rhs < lhs;
+}
+
+template<typename K, typename V, typename C>
+inline bool
+operator>=(const FlatMap<K, V, C>& lhs, const FlatMap<K, V, C>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template<typename K, typename V, typename C>
+inline void
+swap(FlatMap<K, V, C>& lhs, FlatMap<K, V, C>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+}
+
+#endif
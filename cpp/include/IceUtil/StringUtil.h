@@ -12,6 +12,7 @@
 
 #include <IceUtil/Config.h>
 #include <vector>
+#include <string>
 
 namespace IceUtilInternal
 {
@@ -97,6 +98,26 @@ ICE_API bool isDigit(char);
 //
 ICE_API std::string removeWhitespace(const std::string&);
 
+//
+// Seeded string hash. slice2cpp uses it to generate the perfect hash
+// tables of operation names used for dispatch, so it must not change
+// without regenerating the code.
+//
+inline unsigned int
+hashString(const std::string& s, unsigned int seed)
+{
+    unsigned int h = 2166136261U ^ seed;
+    for(std::string::const_iterator p = s.begin(); p != s.end(); ++p)
+    {
+        h ^= static_cast<unsigned char>(*p);
+        h *= 16777619U;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bU;
+    h ^= h >> 13;
+    return h;
+}
+
 }
 
 #endif
@@ -10,6 +10,8 @@
 #include <Ice/BatchRequestQueue.h>
 #include <Ice/Instance.h>
 #include <Ice/Properties.h>
+#include <Ice/Reference.h>
+#include <Ice/LocalException.h>
 
 using namespace std;
 using namespace Ice;
@@ -63,27 +65,62 @@ private:
     const int _size;
 };
 
+class BatchRequestFlushTask : public IceUtil::TimerTask
+{
+public:
+
+    BatchRequestFlushTask(const BatchRequestQueuePtr& queue, const Ice::ObjectPrxPtr& proxy) :
+        _queue(queue), _proxy(proxy)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        _queue->flush(_proxy);
+    }
+
+private:
+
+    const BatchRequestQueuePtr _queue;
+    const Ice::ObjectPrxPtr _proxy;
+};
+
+void
+flushBatchRequests(const Ice::ObjectPrxPtr& proxy)
+{
+#ifdef ICE_CPP11_MAPPING
+    proxy->ice_flushBatchRequestsAsync();
+#else
+    proxy->begin_ice_flushBatchRequests();
+#endif
+}
+
 }
 
 BatchRequestQueue::BatchRequestQueue(const InstancePtr& instance, bool datagram) :
+    _instance(instance),
     _interceptor(instance->initializationData().batchRequestInterceptor),
     _batchStream(instance.get(), Ice::currentProtocolEncoding),
     _batchStreamInUse(false),
     _batchStreamCanFlush(false),
-    _batchRequestNum(0)
+    _batchRequestNum(0),
+    _udpSndSize(0),
+    _flushScheduled(false)
 {
     _batchStream.writeBlob(requestBatchHdr, sizeof(requestBatchHdr));
     _batchMarker = _batchStream.b.size();
 
-    _maxSize = instance->batchAutoFlushSize();
-    if(_maxSize > 0 && datagram)
+    if(datagram)
     {
         const Ice::InitializationData& initData = instance->initializationData();
-        size_t udpSndSize = initData.properties->getPropertyAsIntWithDefault("Ice.UDP.SndSize", 65535 - udpOverhead);
-        if(udpSndSize < _maxSize)
-        {
-            _maxSize = udpSndSize;
-        }
+        _udpSndSize = initData.properties->getPropertyAsIntWithDefault("Ice.UDP.SndSize", 65535 - udpOverhead);
+    }
+
+    _maxSize = instance->batchAutoFlushSize();
+    if(_maxSize > 0 && _udpSndSize > 0 && _udpSndSize < _maxSize)
+    {
+        _maxSize = _udpSndSize;
     }
 }
 
@@ -95,14 +132,30 @@ BatchRequestQueue::prepareBatchRequest(OutputStream* os)
     {
         _exception->ice_throw();
     }
-    waitStreamInUse(false);
-    _batchStreamInUse = true;
-    _batchStream.swap(*os);
+
+    //
+    // Without a batch request interceptor, the request is marshaled in
+    // the stream of the invocation and appended to the batch once it's
+    // complete by finishBatchRequest. Threads queuing requests only wait
+    // for each other while the request is appended.
+    //
+    if(_interceptor)
+    {
+        waitStreamInUse(false);
+        _batchStreamInUse = true;
+        _batchStream.swap(*os);
+    }
 }
 
 void
 BatchRequestQueue::finishBatchRequest(OutputStream* os, const Ice::ObjectPrxPtr& proxy, const std::string& operation)
 {
+    if(!_interceptor)
+    {
+        appendBatchRequest(os, proxy);
+        return;
+    }
+
     //
     // No need for synchronization, no other threads are supposed
     // to modify the queue since we set _batchStreamInUse to true.
@@ -114,13 +167,10 @@ BatchRequestQueue::finishBatchRequest(OutputStream* os, const Ice::ObjectPrxPtr&
     {
         _batchStreamCanFlush = true; // Allow flush to proceed even if the stream is marked in use.
 
-        if(_maxSize > 0 && _batchStream.b.size() >= _maxSize)
+        const size_t maxSize = getMaxSize(proxy);
+        if(maxSize > 0 && _batchStream.b.size() >= maxSize)
         {
-#ifdef ICE_CPP11_MAPPING
-            proxy->ice_flushBatchRequestsAsync();
-#else
-            proxy->begin_ice_flushBatchRequests();
-#endif
+            flushBatchRequests(proxy);
         }
 
         assert(_batchMarker < _batchStream.b.size());
@@ -143,6 +193,7 @@ BatchRequestQueue::finishBatchRequest(OutputStream* os, const Ice::ObjectPrxPtr&
         _batchStream.resize(_batchMarker);
         _batchStreamInUse = false;
         _batchStreamCanFlush = false;
+        scheduleFlush(proxy);
         notifyAll();
     }
     catch(const std::exception&)
@@ -237,3 +288,109 @@ BatchRequestQueue::enqueueBatchRequest()
     _batchMarker = _batchStream.b.size();
     ++_batchRequestNum;
 }
+
+void
+BatchRequestQueue::flush(const ObjectPrxPtr& proxy)
+{
+    {
+        Lock sync(*this);
+        _flushScheduled = false;
+        if(_batchRequestNum == 0)
+        {
+            return;
+        }
+    }
+
+    try
+    {
+        flushBatchRequests(proxy);
+    }
+    catch(const Ice::LocalException&)
+    {
+        // Ignore, the communicator is being destroyed.
+    }
+}
+
+void
+BatchRequestQueue::appendBatchRequest(OutputStream* os, const ObjectPrxPtr& proxy)
+{
+    const size_t maxSize = getMaxSize(proxy);
+    while(true)
+    {
+        {
+            Lock sync(*this);
+            if(_exception)
+            {
+                _exception->ice_throw();
+            }
+
+            //
+            // Flush the queued requests first if the batch would reach
+            // the auto-flush size with this request.
+            //
+            if(maxSize == 0 || _batchRequestNum == 0 || _batchStream.b.size() + os->b.size() < maxSize)
+            {
+                _batchStream.writeBlob(os->b.begin(), os->b.size());
+                _batchMarker = _batchStream.b.size();
+                ++_batchRequestNum;
+                scheduleFlush(proxy);
+                return;
+            }
+        }
+        flushBatchRequests(proxy);
+    }
+}
+
+size_t
+BatchRequestQueue::getMaxSize(const ObjectPrxPtr& proxy) const
+{
+    const int size = proxy->__reference()->getBatchAutoFlushSize();
+    if(size < 0)
+    {
+        return _maxSize;
+    }
+
+    // The proxy setting is in kilobytes.
+    size_t maxSize = static_cast<size_t>(size) > static_cast<size_t>(0x7fffffff / 1024) ?
+        static_cast<size_t>(0x7fffffff) : static_cast<size_t>(size) * 1024;
+    if(maxSize > 0 && _udpSndSize > 0 && _udpSndSize < maxSize)
+    {
+        maxSize = _udpSndSize;
+    }
+    return maxSize;
+}
+
+void
+BatchRequestQueue::scheduleFlush(const ObjectPrxPtr& proxy)
+{
+    //
+    // Must be called with the mutex locked. The timer flushes the batch
+    // at the latest once the auto-flush delay of the oldest queued
+    // request expired.
+    //
+    if(_flushScheduled || _batchRequestNum == 0)
+    {
+        return;
+    }
+
+    int delay = proxy->__reference()->getBatchAutoFlushDelay();
+    if(delay < 0)
+    {
+        delay = _instance->batchAutoFlushDelay();
+    }
+    if(delay == 0)
+    {
+        return;
+    }
+
+    try
+    {
+        _instance->timer()->schedule(ICE_MAKE_SHARED(BatchRequestFlushTask, this, proxy),
+                                     IceUtil::Time::milliSeconds(delay));
+        _flushScheduled = true;
+    }
+    catch(const Ice::CommunicatorDestroyedException&)
+    {
+        // Ignore, the queued requests can't be sent anymore.
+    }
+}
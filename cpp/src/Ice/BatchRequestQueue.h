@@ -40,9 +40,16 @@ public:
 
     void enqueueBatchRequest();
 
+    void flush(const Ice::ObjectPrxPtr&);
+
 private:
 
     void waitStreamInUse(bool);
+    void appendBatchRequest(Ice::OutputStream*, const Ice::ObjectPrxPtr&);
+    size_t getMaxSize(const Ice::ObjectPrxPtr&) const;
+    void scheduleFlush(const Ice::ObjectPrxPtr&);
+
+    const InstancePtr _instance;
 
 #ifdef ICE_CPP11_MAPPING
     std::function<void(const Ice::BatchRequest&, int, int)> _interceptor;
@@ -56,6 +63,8 @@ private:
     size_t _batchMarker;
     IceUtil::UniquePtr<Ice::LocalException> _exception;
     size_t _maxSize;
+    size_t _udpSndSize;
+    bool _flushScheduled;
 };
 
 };
@@ -26,6 +26,7 @@ IceInternal::Buffer::Container::Container() :
     _size(0),
     _capacity(0),
     _shrinkCounter(0),
+    _reallocations(0),
     _owned(true)
 {
 }
@@ -35,12 +36,14 @@ IceInternal::Buffer::Container::Container(const_iterator beg, const_iterator end
     _size(end - beg),
     _capacity(end - beg),
     _shrinkCounter(0),
+    _reallocations(0),
     _owned(false)
 {
 }
 
 IceInternal::Buffer::Container::Container(const vector<value_type>& v) :
-    _shrinkCounter(0)
+    _shrinkCounter(0),
+    _reallocations(0)
 {
     if(v.empty())
     {
@@ -66,12 +69,14 @@ IceInternal::Buffer::Container::Container(Container& other, bool adopt)
         _size = other._size;
         _capacity = other._capacity;
         _shrinkCounter = other._shrinkCounter;
+        _reallocations = other._reallocations;
         _owned = other._owned;
 
         other._buf = 0;
         other._size = 0;
         other._capacity = 0;
         other._shrinkCounter = 0;
+        other._reallocations = 0;
         other._owned = true;
     }
     else
@@ -80,6 +85,7 @@ IceInternal::Buffer::Container::Container(Container& other, bool adopt)
         _size = other._size;
         _capacity = other._capacity;
         _shrinkCounter = 0;
+        _reallocations = 0;
         _owned = false;
     }
 }
@@ -99,6 +105,7 @@ IceInternal::Buffer::Container::swap(Container& other)
     std::swap(_size, other._size);
     std::swap(_capacity, other._capacity);
     std::swap(_shrinkCounter, other._shrinkCounter);
+    std::swap(_reallocations, other._reallocations);
     std::swap(_owned, other._owned);
 }
 
@@ -114,6 +121,7 @@ IceInternal::Buffer::Container::clear()
     _size = 0;
     _capacity = 0;
     _shrinkCounter = 0;
+    _reallocations = 0;
     _owned = true;
 }
 
@@ -123,6 +131,10 @@ IceInternal::Buffer::Container::reserve(size_type n)
     size_type c = _capacity;
     if(n > _capacity)
     {
+        if(_capacity > 0)
+        {
+            ++_reallocations;
+        }
         _capacity = std::max<size_type>(n, 2 * _capacity);
         _capacity = std::max<size_type>(static_cast<size_type>(240), _capacity);
     }
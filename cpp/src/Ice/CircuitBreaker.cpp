@@ -0,0 +1,159 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/CircuitBreaker.h>
+#include <Ice/Instance.h>
+#include <Ice/EndpointI.h>
+#include <Ice/InstrumentationI.h>
+#include <Ice/TraceLevels.h>
+#include <Ice/LoggerUtil.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(CircuitBreaker* p) { return p; }
+
+IceInternal::CircuitBreaker::CircuitBreaker(const InstancePtr& instance,
+                                            const EndpointIPtr& endpoint,
+                                            int failureThreshold,
+                                            const IceUtil::Time& openTimeout) :
+    _instance(instance),
+    _endpoint(endpoint),
+    _failureThreshold(failureThreshold),
+    _openTimeout(openTimeout),
+    _state(ICE_ENUM(CircuitBreakerState, CircuitClosed)),
+    _failures(0)
+{
+}
+
+bool
+IceInternal::CircuitBreaker::allow(const IceUtil::Time& now)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_state == ICE_ENUM(CircuitBreakerState, CircuitClosed))
+    {
+        return true;
+    }
+
+    //
+    // Once the open timeout expired, let a single connection attempt
+    // probe the endpoint. The probe is given the same time to complete,
+    // the connection attempt might not be made if the connection to
+    // another endpoint is established first.
+    //
+    if(now - _stateTime >= _openTimeout)
+    {
+        _state = ICE_ENUM(CircuitBreakerState, CircuitHalfOpen);
+        _stateTime = now;
+        return true;
+    }
+
+    if(_observer)
+    {
+        _observer->failed(_exception->ice_id());
+    }
+    return false;
+}
+
+void
+IceInternal::CircuitBreaker::success()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    _failures = 0;
+    if(_state == ICE_ENUM(CircuitBreakerState, CircuitClosed))
+    {
+        return;
+    }
+
+    _state = ICE_ENUM(CircuitBreakerState, CircuitClosed);
+    if(_observer)
+    {
+        _observer->detach();
+        _observer = 0;
+    }
+
+    if(_instance->traceLevels()->network >= 1)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        out << "closed circuit breaker of " << _endpoint->protocol() << " endpoint `" << _endpoint->toString() << "'";
+    }
+}
+
+void
+IceInternal::CircuitBreaker::failure(const LocalException& ex, const IceUtil::Time& now)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    ++_failures;
+    if(_state == ICE_ENUM(CircuitBreakerState, CircuitHalfOpen) ||
+       (_state == ICE_ENUM(CircuitBreakerState, CircuitClosed) && _failures >= _failureThreshold))
+    {
+        open(ex, now);
+    }
+}
+
+void
+IceInternal::CircuitBreaker::throwException() const
+{
+    IceUtil::Mutex::Lock sync(*this);
+    assert(_exception);
+    _exception->ice_throw();
+}
+
+CircuitBreakerInfo
+IceInternal::CircuitBreaker::getInfo() const
+{
+    IceUtil::Mutex::Lock sync(*this);
+    CircuitBreakerInfo info;
+    info.endpoint = _endpoint->toString();
+    info.state = _state;
+    info.failures = _failures;
+    return info;
+}
+
+void
+IceInternal::CircuitBreaker::destroy()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_observer)
+    {
+        _observer->detach();
+        _observer = 0;
+    }
+}
+
+void
+IceInternal::CircuitBreaker::open(const LocalException& ex, const IceUtil::Time& now)
+{
+    // Must be called with the mutex locked.
+    _state = ICE_ENUM(CircuitBreakerState, CircuitOpen);
+    _stateTime = now;
+    ICE_SET_EXCEPTION_FROM_CLONE(_exception, ex.ice_clone());
+
+    if(!_observer)
+    {
+        CommunicatorObserverI* observer =
+            dynamic_cast<CommunicatorObserverI*>(_instance->initializationData().observer.get());
+        if(observer)
+        {
+            _observer = observer->getCircuitBreakerObserver(_endpoint);
+            if(_observer)
+            {
+                _observer->attach();
+            }
+        }
+    }
+
+    if(_instance->traceLevels()->network >= 1)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        out << "opened circuit breaker of " << _endpoint->protocol() << " endpoint `" << _endpoint->toString()
+            << "' after " << _failures << " consecutive failures\n" << ex;
+    }
+}
@@ -0,0 +1,67 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_CIRCUIT_BREAKER_H
+#define ICE_CIRCUIT_BREAKER_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <IceUtil/UniquePtr.h>
+#include <Ice/CircuitBreakerF.h>
+#include <Ice/CircuitBreakerAdmin.h>
+#include <Ice/EndpointIF.h>
+#include <Ice/InstanceF.h>
+#include <Ice/Instrumentation.h>
+
+namespace IceInternal
+{
+
+//
+// The circuit breaker of an endpoint. The circuit opens after a number
+// of consecutive failures to connect to the endpoint or of connections
+// lost with requests awaiting a reply. While the circuit is open, the
+// endpoint is skipped by the outgoing connection factory. Once the open
+// timeout expired, the circuit is half-open: a single connection
+// attempt probes the endpoint and closes the circuit if it succeeds.
+//
+class CircuitBreaker : public IceUtil::Shared, public IceUtil::Mutex
+{
+public:
+
+    CircuitBreaker(const InstancePtr&, const EndpointIPtr&, int, const IceUtil::Time&);
+
+    bool allow(const IceUtil::Time&);
+    void success();
+    void failure(const Ice::LocalException&, const IceUtil::Time&);
+
+    void throwException() const;
+    Ice::CircuitBreakerInfo getInfo() const;
+
+    void destroy();
+
+private:
+
+    void open(const Ice::LocalException&, const IceUtil::Time&);
+
+    const InstancePtr _instance;
+    const EndpointIPtr _endpoint;
+    const int _failureThreshold;
+    const IceUtil::Time _openTimeout;
+
+    Ice::CircuitBreakerState _state;
+    int _failures;
+    IceUtil::Time _stateTime;
+    IceUtil::UniquePtr<Ice::LocalException> _exception;
+    Ice::Instrumentation::ObserverPtr _observer;
+};
+
+}
+
+#endif
@@ -0,0 +1,35 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/CircuitBreakerAdminI.h>
+#include <Ice/CircuitBreaker.h>
+#include <Ice/ConnectionFactory.h>
+#include <Ice/Instance.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceInternal::CircuitBreakerAdminI::CircuitBreakerAdminI(const InstancePtr& instance) :
+    _instance(instance)
+{
+}
+
+CircuitBreakerInfoSeq
+IceInternal::CircuitBreakerAdminI::getCircuitBreakers(const Current&)
+{
+    vector<CircuitBreakerPtr> circuitBreakers = _instance->outgoingConnectionFactory()->getCircuitBreakers();
+    CircuitBreakerInfoSeq infos;
+    infos.reserve(circuitBreakers.size());
+    for(vector<CircuitBreakerPtr>::const_iterator p = circuitBreakers.begin(); p != circuitBreakers.end(); ++p)
+    {
+        infos.push_back((*p)->getInfo());
+    }
+    return infos;
+}
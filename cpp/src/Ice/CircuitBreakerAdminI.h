@@ -0,0 +1,39 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_CIRCUIT_BREAKER_ADMIN_I_H
+#define ICE_CIRCUIT_BREAKER_ADMIN_I_H
+
+#include <Ice/CircuitBreakerAdmin.h>
+#include <Ice/InstanceF.h>
+
+namespace IceInternal
+{
+
+class CircuitBreakerAdminI : public Ice::CircuitBreakerAdmin
+{
+public:
+
+    CircuitBreakerAdminI(const InstancePtr&);
+
+#ifdef ICE_CPP11_MAPPING
+    virtual Ice::CircuitBreakerInfoSeq getCircuitBreakers(const Ice::Current&) override;
+#else
+    virtual Ice::CircuitBreakerInfoSeq getCircuitBreakers(const Ice::Current&);
+#endif
+
+private:
+
+    const InstancePtr _instance;
+};
+ICE_DEFINE_PTR(CircuitBreakerAdminIPtr, CircuitBreakerAdminI);
+
+}
+
+#endif
@@ -33,8 +33,10 @@ public:
                    OutputStream* os,
                    const CollocatedRequestHandlerPtr& handler,
                    Int requestId,
-                   Int batchRequestNum) :
-        _outAsync(outAsync), _os(os), _handler(handler), _requestId(requestId), _batchRequestNum(batchRequestNum)
+                   Int batchRequestNum,
+                   const IceUtil::Time& received) :
+        _outAsync(outAsync), _os(os), _handler(handler), _requestId(requestId), _batchRequestNum(batchRequestNum),
+        _received(received)
     {
     }
 
@@ -43,7 +45,7 @@ public:
     {
         if(_handler->sentAsync(_outAsync.get()))
         {
-            _handler->invokeAll(_os, _requestId, _batchRequestNum);
+            _handler->invokeAll(_os, _requestId, _batchRequestNum, _received);
         }
     }
 
@@ -54,6 +56,7 @@ private:
     CollocatedRequestHandlerPtr _handler;
     Int _requestId;
     Int _batchRequestNum;
+    const IceUtil::Time _received;
 };
 
 void
@@ -169,6 +172,16 @@ CollocatedRequestHandler::invokeAsyncRequest(OutgoingAsyncBase* outAsync, int ba
 
     outAsync->attachCollocatedObserver(_adapter, requestId);
 
+    //
+    // With deadline propagation, the deadline of the request is relative
+    // to the time it's queued for dispatch.
+    //
+    IceUtil::Time received;
+    if(_reference->getInstance()->deadlinePropagation())
+    {
+        received = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    }
+
     if(!synchronous || !_response || _reference->getInvocationTimeout() > 0)
     {
         // Don't invoke from the user thread if async or invocation timeout is set
@@ -176,7 +189,8 @@ CollocatedRequestHandler::invokeAsyncRequest(OutgoingAsyncBase* outAsync, int ba
                                                                outAsync->getOs(),
                                                                ICE_SHARED_FROM_THIS,
                                                                requestId,
-                                                               batchRequestNum));
+                                                               batchRequestNum,
+                                                               received));
     }
     else if(_dispatcher)
     {
@@ -184,7 +198,8 @@ CollocatedRequestHandler::invokeAsyncRequest(OutgoingAsyncBase* outAsync, int ba
                                                                              outAsync->getOs(),
                                                                              ICE_SHARED_FROM_THIS,
                                                                              requestId,
-                                                                             batchRequestNum));
+                                                                             batchRequestNum,
+                                                                             received));
     }
     else // Optimization: directly call invokeAll if there's no dispatcher.
     {
@@ -197,7 +212,7 @@ CollocatedRequestHandler::invokeAsyncRequest(OutgoingAsyncBase* outAsync, int ba
         CollocatedRequestHandlerPtr self(ICE_SHARED_FROM_THIS);
         if(sentAsync(outAsync))
         {
-            invokeAll(outAsync->getOs(), requestId, batchRequestNum);
+            invokeAll(outAsync->getOs(), requestId, batchRequestNum, received);
         }
     }
     return AsyncStatusQueued;
@@ -309,7 +324,8 @@ CollocatedRequestHandler::sentAsync(OutgoingAsyncBase* outAsync)
 }
 
 void
-CollocatedRequestHandler::invokeAll(OutputStream* os, Int requestId, Int batchRequestNum)
+CollocatedRequestHandler::invokeAll(OutputStream* os, Int requestId, Int batchRequestNum,
+                                    const IceUtil::Time& received)
 {
     if(_traceLevels->protocol >= 1)
     {
@@ -359,8 +375,8 @@ CollocatedRequestHandler::invokeAll(OutputStream* os, Int requestId, Int batchRe
             }
 
             Incoming in(_reference->getInstance().get(), this, 0, _adapter, _response, 0, requestId);
-            in.invoke(servantManager, &is);
-            --invokeNum;
+            in.invoke(servantManager, &is, received, invokeNum - 1);
+            invokeNum -= 1 + in.batchDispatched();
         }
     }
     catch(const LocalException& ex)
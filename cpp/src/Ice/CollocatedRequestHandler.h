@@ -55,6 +55,7 @@ public:
     virtual void invokeException(Ice::Int, const Ice::LocalException&, int, bool);
 
     const ReferencePtr& getReference() const { return _reference; } // Inlined for performances.
+    const Ice::ObjectAdapterIPtr& getAdapter() const { return _adapter; } // Inlined for performances.
 
     virtual Ice::ConnectionIPtr getConnection();
     virtual Ice::ConnectionIPtr waitForConnection();
@@ -63,7 +64,7 @@ public:
 
     bool sentAsync(OutgoingAsyncBase*);
 
-    void invokeAll(Ice::OutputStream*, Ice::Int, Ice::Int);
+    void invokeAll(Ice::OutputStream*, Ice::Int, Ice::Int, const IceUtil::Time&);
 
 #ifdef ICE_CPP11_MAPPING
     std::shared_ptr<CollocatedRequestHandler> shared_from_this()
@@ -309,7 +309,8 @@ ConnectRequestHandler::flushRequests()
     // If we aren't caching the connection, don't bother creating a
     // connection request handler. Otherwise, update the proxies
     // request handler to use the more efficient connection request
-    // handler.
+    // handler and make it available to the proxies with the same
+    // connection settings.
     //
     if(_reference->getCacheConnection() && !exception)
     {
@@ -318,6 +319,15 @@ ConnectRequestHandler::flushRequests()
         {
             (*p)->__updateRequestHandler(ICE_SHARED_FROM_THIS, _requestHandler);
         }
+
+        try
+        {
+            _reference->getInstance()->requestHandlerFactory()->addRequestHandler(_reference, _requestHandler);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+            // Ignore
+        }
     }
 
     {
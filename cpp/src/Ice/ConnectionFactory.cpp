@@ -13,6 +13,8 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/TraceLevels.h>
 #include <Ice/DefaultsAndOverrides.h>
+#include <Ice/EndpointLoad.h>
+#include <Ice/CircuitBreaker.h>
 #include <Ice/Properties.h>
 #include <Ice/Transceiver.h>
 #include <Ice/Connector.h>
@@ -199,6 +201,18 @@ IceInternal::OutgoingConnectionFactory::waitUntilFinished()
         cons.clear();
         _connections.clear();
         _connectionsByEndpoint.clear();
+        _endpointLoads.clear();
+
+#ifdef ICE_CPP11_MAPPING
+        for(map<EndpointIPtr, CircuitBreakerPtr, Ice::TargetCompare<EndpointIPtr, std::less>>::const_iterator p =
+#else
+        for(map<EndpointIPtr, CircuitBreakerPtr>::const_iterator p =
+#endif
+                _circuitBreakers.begin(); p != _circuitBreakers.end(); ++p)
+        {
+            p->second->destroy();
+        }
+        _circuitBreakers.clear();
         _monitor->destroy();
     }
 }
@@ -220,6 +234,11 @@ IceInternal::OutgoingConnectionFactory::create(const vector<EndpointIPtr>& endpt
     //
     try
     {
+        if(_circuitBreakerThreshold > 0)
+        {
+            removeOpenCircuits(endpoints);
+        }
+
         bool compress;
         Ice::ConnectionIPtr connection = findConnection(endpoints, compress);
         if(connection)
@@ -242,6 +261,63 @@ IceInternal::OutgoingConnectionFactory::create(const vector<EndpointIPtr>& endpt
     cb->getConnectors();
 }
 
+void
+IceInternal::OutgoingConnectionFactory::sortByLoad(vector<EndpointIPtr>& endpoints)
+{
+    //
+    // Sort the endpoints by increasing load, the endpoints with the same
+    // load keep their order.
+    //
+    vector<pair<Ice::Long, size_t> > costs;
+    costs.reserve(endpoints.size());
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        if(_destroyed)
+        {
+            throw CommunicatorDestroyedException(__FILE__, __LINE__);
+        }
+
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+        {
+#ifdef ICE_CPP11_MAPPING
+            map<EndpointIPtr, EndpointLoadPtr, Ice::TargetCompare<EndpointIPtr, std::less>>::const_iterator q =
+#else
+            map<EndpointIPtr, EndpointLoadPtr>::const_iterator q =
+#endif
+                _endpointLoads.find(getEndpointKey(*p));
+            costs.push_back(make_pair(q != _endpointLoads.end() ? q->second->cost(now) : 0, costs.size()));
+        }
+    }
+
+    sort(costs.begin(), costs.end());
+
+    vector<EndpointIPtr> sorted;
+    sorted.reserve(endpoints.size());
+    for(vector<pair<Ice::Long, size_t> >::const_iterator p = costs.begin(); p != costs.end(); ++p)
+    {
+        sorted.push_back(endpoints[p->second]);
+    }
+    endpoints.swap(sorted);
+}
+
+vector<CircuitBreakerPtr>
+IceInternal::OutgoingConnectionFactory::getCircuitBreakers()
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    vector<CircuitBreakerPtr> circuitBreakers;
+#ifdef ICE_CPP11_MAPPING
+    for(map<EndpointIPtr, CircuitBreakerPtr, Ice::TargetCompare<EndpointIPtr, std::less>>::const_iterator p =
+#else
+    for(map<EndpointIPtr, CircuitBreakerPtr>::const_iterator p =
+#endif
+            _circuitBreakers.begin(); p != _circuitBreakers.end(); ++p)
+    {
+        circuitBreakers.push_back(p->second);
+    }
+    return circuitBreakers;
+}
+
 void
 IceInternal::OutgoingConnectionFactory::setRouterInfo(const RouterInfoPtr& routerInfo)
 {
@@ -350,6 +426,10 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(const Communic
     _communicator(communicator),
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, instance->clientACM())),
+    _circuitBreakerThreshold(instance->initializationData().properties->getPropertyAsInt(
+                                 "Ice.CircuitBreaker.FailureThreshold")),
+    _circuitBreakerTimeout(IceUtil::Time::milliSeconds(instance->initializationData().properties->
+                               getPropertyAsIntWithDefault("Ice.CircuitBreaker.OpenTimeout", 5000))),
     _destroyed(false),
     _pendingConnectCount(0)
 {
@@ -586,7 +666,8 @@ IceInternal::OutgoingConnectionFactory::createConnection(const TransceiverPtr& t
         }
 
         connection = ConnectionI::create(_communicator, _instance, _monitor, transceiver, ci.connector,
-                                         ci.endpoint->compress(false), ICE_NULLPTR);
+                                         ci.endpoint->compress(false), ICE_NULLPTR, getEndpointLoad(ci.endpoint),
+                                         getCircuitBreaker(ci.endpoint));
     }
     catch(const Ice::LocalException&)
     {
@@ -839,6 +920,147 @@ IceInternal::OutgoingConnectionFactory::handleConnectionException(const LocalExc
     }
 }
 
+EndpointIPtr
+IceInternal::OutgoingConnectionFactory::getEndpointKey(const EndpointIPtr& endpoint) const
+{
+    //
+    // The load and the circuit breakers are tracked by endpoint,
+    // regardless of its compression flag, with the timeout used by the
+    // connections to the endpoint.
+    //
+    EndpointIPtr key = endpoint->compress(false);
+    DefaultsAndOverridesPtr defaultsAndOverrides = _instance->defaultsAndOverrides();
+    if(defaultsAndOverrides->overrideTimeout)
+    {
+        key = key->timeout(defaultsAndOverrides->overrideTimeoutValue);
+    }
+    return key;
+}
+
+EndpointLoadPtr
+IceInternal::OutgoingConnectionFactory::getEndpointLoad(const EndpointIPtr& endpoint)
+{
+    // Must be called with the mutex locked.
+    EndpointIPtr key = getEndpointKey(endpoint);
+#ifdef ICE_CPP11_MAPPING
+    map<EndpointIPtr, EndpointLoadPtr, Ice::TargetCompare<EndpointIPtr, std::less>>::iterator p =
+#else
+    map<EndpointIPtr, EndpointLoadPtr>::iterator p =
+#endif
+        _endpointLoads.find(key);
+    if(p == _endpointLoads.end())
+    {
+        p = _endpointLoads.insert(make_pair(key, new EndpointLoad())).first;
+    }
+    return p->second;
+}
+
+CircuitBreakerPtr
+IceInternal::OutgoingConnectionFactory::getCircuitBreaker(const EndpointIPtr& endpoint)
+{
+    // Must be called with the mutex locked.
+    if(_circuitBreakerThreshold <= 0)
+    {
+        return 0;
+    }
+
+    EndpointIPtr key = getEndpointKey(endpoint);
+#ifdef ICE_CPP11_MAPPING
+    map<EndpointIPtr, CircuitBreakerPtr, Ice::TargetCompare<EndpointIPtr, std::less>>::iterator p =
+#else
+    map<EndpointIPtr, CircuitBreakerPtr>::iterator p =
+#endif
+        _circuitBreakers.find(key);
+    if(p == _circuitBreakers.end())
+    {
+        CircuitBreakerPtr circuitBreaker = new CircuitBreaker(_instance, key, _circuitBreakerThreshold,
+                                                              _circuitBreakerTimeout);
+        p = _circuitBreakers.insert(make_pair(key, circuitBreaker)).first;
+    }
+    return p->second;
+}
+
+void
+IceInternal::OutgoingConnectionFactory::removeOpenCircuits(vector<EndpointIPtr>& endpoints)
+{
+    //
+    // Skip the endpoints whose circuit is open. If the circuits of all
+    // the endpoints are open, fail immediately with the exception which
+    // opened the circuit of the first endpoint.
+    //
+    CircuitBreakerPtr open;
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        if(_destroyed)
+        {
+            throw CommunicatorDestroyedException(__FILE__, __LINE__);
+        }
+
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        vector<EndpointIPtr>::iterator p = endpoints.begin();
+        while(p != endpoints.end())
+        {
+#ifdef ICE_CPP11_MAPPING
+            map<EndpointIPtr, CircuitBreakerPtr, Ice::TargetCompare<EndpointIPtr, std::less>>::const_iterator q =
+#else
+            map<EndpointIPtr, CircuitBreakerPtr>::const_iterator q =
+#endif
+                _circuitBreakers.find(getEndpointKey(*p));
+            if(q != _circuitBreakers.end() && !q->second->allow(now))
+            {
+                if(!open)
+                {
+                    open = q->second;
+                }
+                p = endpoints.erase(p);
+            }
+            else
+            {
+                ++p;
+            }
+        }
+    }
+
+    if(endpoints.empty())
+    {
+        open->throwException();
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::connectionEstablished(const EndpointIPtr& endpoint)
+{
+    if(_circuitBreakerThreshold > 0)
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+#ifdef ICE_CPP11_MAPPING
+        map<EndpointIPtr, CircuitBreakerPtr, Ice::TargetCompare<EndpointIPtr, std::less>>::const_iterator p =
+#else
+        map<EndpointIPtr, CircuitBreakerPtr>::const_iterator p =
+#endif
+            _circuitBreakers.find(getEndpointKey(endpoint));
+        if(p != _circuitBreakers.end())
+        {
+            p->second->success();
+        }
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::connectionFailed(const EndpointIPtr& endpoint, const LocalException& ex)
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    if(!_destroyed)
+    {
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        getEndpointLoad(endpoint)->connectionFailed(now);
+        if(_circuitBreakerThreshold > 0)
+        {
+            getCircuitBreaker(endpoint)->failure(ex, now);
+        }
+    }
+}
+
 IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const InstancePtr& instance,
                                                                          const OutgoingConnectionFactoryPtr& factory,
                                                                          const vector<EndpointIPtr>& endpoints,
@@ -867,6 +1089,7 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartComplete
     }
 
     connection->activate();
+    _factory->connectionEstablished(_iter->endpoint);
     _factory->finishGetConnection(_connectors, *_iter, connection, ICE_SHARED_FROM_THIS);
 }
 
@@ -1115,8 +1338,11 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedIm
     if(dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex)) // No need to continue.
     {
         _factory->finishGetConnection(_connectors, ex, ICE_SHARED_FROM_THIS);
+        return false;
     }
-    else if(++_iter != _connectors.end()) // Try the next connector.
+
+    _factory->connectionFailed(_iter->endpoint, ex);
+    if(++_iter != _connectors.end()) // Try the next connector.
     {
         return true;
     }
@@ -1402,7 +1628,7 @@ IceInternal::IncomingConnectionFactory::message(ThreadPoolCurrent& current)
         try
         {
             connection = ConnectionI::create(_adapter->getCommunicator(), _instance, _monitor, transceiver, 0,
-                                             _endpoint, _adapter);
+                                             _endpoint, _adapter, 0, 0);
         }
         catch(const LocalException& ex)
         {
@@ -1614,7 +1840,7 @@ IceInternal::IncomingConnectionFactory::initialize()
             }
             const_cast<EndpointIPtr&>(_endpoint) = _transceiver->bind();
             ConnectionIPtr connection(ConnectionI::create(_adapter->getCommunicator(), _instance, 0, _transceiver, 0,
-                                                          _endpoint, _adapter));
+                                                          _endpoint, _adapter, 0, 0));
             connection->start(0);
             _connections.insert(connection);
         }
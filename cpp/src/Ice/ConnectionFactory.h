@@ -27,6 +27,8 @@
 #include <Ice/EndpointI.h>
 #include <Ice/InstrumentationF.h>
 #include <Ice/ACMF.h>
+#include <Ice/EndpointLoadF.h>
+#include <Ice/CircuitBreakerF.h>
 #include <Ice/Comparable.h>
 
 #include <list>
@@ -64,6 +66,8 @@ public:
     void waitUntilFinished();
 
     void create(const std::vector<EndpointIPtr>&, bool, Ice::EndpointSelectionType, const CreateConnectionCallbackPtr&);
+    void sortByLoad(std::vector<EndpointIPtr>&);
+    std::vector<CircuitBreakerPtr> getCircuitBreakers();
     void setRouterInfo(const RouterInfoPtr&);
     void removeAdapter(const Ice::ObjectAdapterPtr&);
     void flushAsyncBatchRequests(const CommunicatorFlushBatchAsyncPtr&);
@@ -155,9 +159,18 @@ private:
     void handleException(const Ice::LocalException&, bool);
     void handleConnectionException(const Ice::LocalException&, bool);
 
+    EndpointIPtr getEndpointKey(const EndpointIPtr&) const;
+    EndpointLoadPtr getEndpointLoad(const EndpointIPtr&);
+    CircuitBreakerPtr getCircuitBreaker(const EndpointIPtr&);
+    void removeOpenCircuits(std::vector<EndpointIPtr>&);
+    void connectionEstablished(const EndpointIPtr&);
+    void connectionFailed(const EndpointIPtr&, const Ice::LocalException&);
+
     Ice::CommunicatorPtr _communicator;
     const InstancePtr _instance;
     const FactoryACMMonitorPtr _monitor;
+    const int _circuitBreakerThreshold;
+    const IceUtil::Time _circuitBreakerTimeout;
     bool _destroyed;
 
     std::multimap<ConnectorPtr, Ice::ConnectionIPtr> _connections;
@@ -168,6 +181,18 @@ private:
 #else
     std::multimap<EndpointIPtr, Ice::ConnectionIPtr> _connectionsByEndpoint;
 #endif
+
+#ifdef ICE_CPP11_MAPPING
+    std::map<EndpointIPtr, EndpointLoadPtr, Ice::TargetCompare<EndpointIPtr, std::less>> _endpointLoads;
+#else
+    std::map<EndpointIPtr, EndpointLoadPtr> _endpointLoads;
+#endif
+
+#ifdef ICE_CPP11_MAPPING
+    std::map<EndpointIPtr, CircuitBreakerPtr, Ice::TargetCompare<EndpointIPtr, std::less>> _circuitBreakers;
+#else
+    std::map<EndpointIPtr, CircuitBreakerPtr> _circuitBreakers;
+#endif
     int _pendingConnectCount;
 };
 
@@ -27,6 +27,8 @@
 #include <Ice/ReferenceFactory.h> // For createProxy().
 #include <Ice/ProxyFactory.h> // For createProxy().
 #include <Ice/BatchRequestQueue.h>
+#include <Ice/CircuitBreaker.h>
+#include <Ice/ReplyStatus.h>
 
 #ifdef ICE_HAS_BZIP2
 #  include <bzlib.h>
@@ -73,7 +75,7 @@ public:
                  const vector<ConnectionI::OutgoingMessage>& sentCBs, Byte compress, Int requestId,
                  Int invokeNum, const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
                  const OutgoingAsyncBasePtr& outAsync, const ICE_HEARTBEAT_CALLBACK& heartbeatCallback,
-                 InputStream& stream) :
+                 InputStream& stream, const IceUtil::Time& received) :
         DispatchWorkItem(connection),
         _connection(connection),
         _startCB(startCB),
@@ -85,7 +87,8 @@ public:
         _adapter(adapter),
         _outAsync(outAsync),
         _heartbeatCallback(heartbeatCallback),
-        _stream(stream.instance(), currentProtocolEncoding)
+        _stream(stream.instance(), currentProtocolEncoding),
+        _received(received)
     {
         _stream.swap(stream);
     }
@@ -94,7 +97,7 @@ public:
     run()
     {
         _connection->dispatch(_startCB, _sentCBs, _compress, _requestId, _invokeNum, _servantManager, _adapter,
-                              _outAsync, _heartbeatCallback, _stream);
+                              _outAsync, _heartbeatCallback, _stream, _received);
     }
 
 private:
@@ -110,6 +113,49 @@ private:
     const OutgoingAsyncBasePtr _outAsync;
     const ICE_HEARTBEAT_CALLBACK _heartbeatCallback;
     InputStream _stream;
+    const IceUtil::Time _received;
+};
+
+//
+// A request queued with the thread pool by the admission control of
+// the object adapter.
+//
+class QueuedDispatchCall : public DispatchWorkItem
+{
+public:
+
+    QueuedDispatchCall(const ConnectionIPtr& connection, Byte compress, Int requestId,
+                       const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
+                       InputStream& stream, const IceUtil::Time& received) :
+        DispatchWorkItem(connection),
+        _connection(connection),
+        _compress(compress),
+        _requestId(requestId),
+        _servantManager(servantManager),
+        _adapter(adapter),
+        _stream(stream.instance(), currentProtocolEncoding),
+        _received(received)
+    {
+        _stream.swap(stream);
+    }
+
+    virtual void
+    run()
+    {
+        dynamic_cast<ObjectAdapterI*>(_adapter.get())->dequeueDispatch();
+        _connection->dispatch(0, vector<ConnectionI::OutgoingMessage>(), _compress, _requestId, 1, _servantManager,
+                              _adapter, 0, ICE_HEARTBEAT_CALLBACK(), _stream, _received);
+    }
+
+private:
+
+    const ConnectionIPtr _connection;
+    const Byte _compress;
+    const Int _requestId;
+    const ServantManagerPtr _servantManager;
+    const ObjectAdapterPtr _adapter;
+    InputStream _stream;
+    const IceUtil::Time _received;
 };
 
 class FinishCall : public DispatchWorkItem
@@ -590,7 +636,7 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
             setState(StateClosed, ConnectionTimeoutException(__FILE__, __LINE__));
         }
         else if(acm.close != CloseOnInvocation && _dispatchCount == 0 && _batchRequestQueue->isEmpty() &&
-                _asyncRequests.empty())
+                _batchTwowayRequests.empty() && _asyncRequests.empty())
         {
             //
             // The connection is idle, close it.
@@ -688,6 +734,60 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
     return status;
 }
 
+AsyncStatus
+Ice::ConnectionI::sendBatchTwowayRequest(const OutgoingAsyncBasePtr& out, bool compress, bool flush)
+{
+    vector<OutgoingMessage> sentCBs;
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        if(_exception)
+        {
+            throw RetryException(*_exception);
+        }
+        assert(_state > StateNotValidated);
+        assert(_state < StateClosing);
+
+        _transceiver->checkSendSize(*out->getOs());
+
+        //
+        // The request is cancelable with this connection until it's
+        // flushed, it's then cancelable like any other sent request.
+        //
+        out->cancelable(ICE_SHARED_FROM_THIS);
+        _batchTwowayRequests.push_back(OutgoingMessage(out, out->getOs(), compress, 0));
+        if(!flush)
+        {
+            return AsyncStatusQueued;
+        }
+        flushBatchTwowayRequests(sentCBs);
+    }
+
+    for(vector<OutgoingMessage>::const_iterator p = sentCBs.begin(); p != sentCBs.end(); ++p)
+    {
+        p->outAsync->invokeSentAsync();
+    }
+    return AsyncStatusQueued;
+}
+
+void
+Ice::ConnectionI::flushBatchTwowayRequests()
+{
+    vector<OutgoingMessage> sentCBs;
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        if(_batchTwowayRequests.empty() || _state >= StateClosing)
+        {
+            return; // Queued requests are failed with the connection exception once the connection is closed.
+        }
+        flushBatchTwowayRequests(sentCBs);
+    }
+
+    for(vector<OutgoingMessage>::const_iterator p = sentCBs.begin(); p != sentCBs.end(); ++p)
+    {
+        p->outAsync->invokeSentAsync();
+    }
+}
+
 BatchRequestQueuePtr
 Ice::ConnectionI::getBatchRequestQueue() const
 {
@@ -933,6 +1033,22 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
         return; // The request has already been or will be shortly notified of the failure.
     }
 
+    for(vector<OutgoingMessage>::iterator o = _batchTwowayRequests.begin(); o != _batchTwowayRequests.end(); ++o)
+    {
+        if(o->outAsync.get() == outAsync.get())
+        {
+            //
+            // The request wasn't flushed yet, it's not known to the peer.
+            //
+            _batchTwowayRequests.erase(o);
+            if(outAsync->exception(ex))
+            {
+                outAsync->invokeExceptionAsync();
+            }
+            return;
+        }
+    }
+
     for(deque<OutgoingMessage>::iterator o = _sendStreams.begin(); o != _sendStreams.end(); ++o)
     {
         if(o->outAsync.get() == outAsync.get())
@@ -1048,6 +1164,11 @@ Ice::ConnectionI::sendResponse(Int, OutputStream* os, Byte compressFlag, bool /*
             _exception->ice_throw();
         }
 
+        if(_readSuspended && _dispatchCount < _maxDispatches)
+        {
+            resumeReading();
+        }
+
         OutgoingMessage message(os, compressFlag > 0);
         sendMessage(message);
 
@@ -1087,6 +1208,11 @@ Ice::ConnectionI::sendNoResponse()
             _exception->ice_throw();
         }
 
+        if(_readSuspended && _dispatchCount < _maxDispatches)
+        {
+            resumeReading();
+        }
+
         if(_state == StateClosing && _dispatchCount == 0)
         {
             initiateShutdown();
@@ -1142,6 +1268,12 @@ Ice::ConnectionI::connector() const
     return _connector; // No mutex protection necessary, _connector is immutable.
 }
 
+EndpointLoadPtr
+Ice::ConnectionI::endpointLoad() const
+{
+    return _endpointLoad; // No mutex protection necessary, _endpointLoad is immutable.
+}
+
 void
 Ice::ConnectionI::setAdapter(const ObjectAdapterPtr& adapter)
 {
@@ -1502,6 +1634,18 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                     }
                 }
 
+                //
+                // Stop reading the connection if the requests received
+                // reach the dispatch limit, the remaining requests are
+                // left in the transport until a dispatch completes.
+                //
+                if(invokeNum > 0 && _maxDispatches > 0 && _state == StateActive &&
+                   _dispatchCount + dispatchCount >= _maxDispatches)
+                {
+                    newOp = static_cast<SocketOperation>(newOp & ~SocketOperationRead);
+                    _readSuspended = true;
+                }
+
                 if(_state < StateClosed)
                 {
                     scheduleTimeout(newOp);
@@ -1560,16 +1704,36 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
         }
     }
 
+    //
+    // The deadlines of the requests are relative to the time the
+    // requests are received, requests which expire while waiting to
+    // be dispatched are dropped.
+    //
+    IceUtil::Time received;
+    if(invokeNum && _instance->deadlinePropagation())
+    {
+        received = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    }
+
+    if(invokeNum == 1 && queueRequest(current.stream, requestId, compress, servantManager, adapter, received))
+    {
+        invokeNum = 0;
+        if(!startCB && sentCBs.empty() && !outAsync && !heartbeatCallback)
+        {
+            return;
+        }
+    }
+
     if(!_dispatcher) // Optimization, call dispatch() directly if there's no dispatcher.
     {
         dispatch(startCB, sentCBs, compress, requestId, invokeNum, servantManager, adapter, outAsync, heartbeatCallback,
-                 current.stream);
+                 current.stream, received);
     }
     else
     {
         _threadPool->dispatchFromThisThread(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress, requestId,
                                                              invokeNum, servantManager, adapter, outAsync,
-                                                             heartbeatCallback, current.stream));
+                                                             heartbeatCallback, current.stream, received));
 
     }
 }
@@ -1578,7 +1742,8 @@ void
 ConnectionI::dispatch(const StartCallbackPtr& startCB, const vector<OutgoingMessage>& sentCBs,
                       Byte compress, Int requestId, Int invokeNum, const ServantManagerPtr& servantManager,
                       const ObjectAdapterPtr& adapter, const OutgoingAsyncBasePtr& outAsync,
-                      const ICE_HEARTBEAT_CALLBACK& heartbeatCallback, InputStream& stream)
+                      const ICE_HEARTBEAT_CALLBACK& heartbeatCallback, InputStream& stream,
+                      const IceUtil::Time& received)
 {
     int dispatchedCount = 0;
 
@@ -1659,7 +1824,7 @@ ConnectionI::dispatch(const StartCallbackPtr& startCB, const vector<OutgoingMess
     //
     if(invokeNum)
     {
-        invokeAll(stream, invokeNum, requestId, compress, servantManager, adapter);
+        invokeAll(stream, invokeNum, requestId, compress, servantManager, adapter, received);
 
         //
         // Don't increase count, the dispatch count is
@@ -1674,6 +1839,10 @@ ConnectionI::dispatch(const StartCallbackPtr& startCB, const vector<OutgoingMess
     {
         IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
         _dispatchCount -= dispatchedCount;
+        if(_readSuspended && _dispatchCount < _maxDispatches && _state < StateClosed)
+        {
+            resumeReading();
+        }
         if(_dispatchCount == 0)
         {
             //
@@ -1716,7 +1885,8 @@ Ice::ConnectionI::finished(ThreadPoolCurrent& current, bool close)
     // to call code that will potentially block (this avoids promoting a new leader and
     // unecessary thread creation, especially if this is called on shutdown).
     //
-    if(!_startCallback && _sendStreams.empty() && _asyncRequests.empty() && !_closeCallback && !_heartbeatCallback)
+    if(!_startCallback && _sendStreams.empty() && _batchTwowayRequests.empty() && _asyncRequests.empty() &&
+       !_closeCallback && !_heartbeatCallback)
     {
         finish(close);
         return;
@@ -1765,6 +1935,19 @@ Ice::ConnectionI::finish(bool close)
         }
     }
 
+    //
+    // A connection lost with requests awaiting a reply is a failure of
+    // the endpoint for its circuit breaker.
+    //
+    if(_circuitBreaker && _initialized && (!_asyncRequests.empty() || !_sendStreams.empty()) &&
+       !(dynamic_cast<const CloseConnectionException*>(_exception.get()) ||
+         dynamic_cast<const ForcedCloseConnectionException*>(_exception.get()) ||
+         dynamic_cast<const CommunicatorDestroyedException*>(_exception.get()) ||
+         dynamic_cast<const ObjectAdapterDeactivatedException*>(_exception.get())))
+    {
+        _circuitBreaker->failure(*_exception, IceUtil::Time::now(IceUtil::Time::Monotonic));
+    }
+
     if(close)
     {
         try
@@ -1835,6 +2018,12 @@ Ice::ConnectionI::finish(bool close)
         _sendStreams.clear();
     }
 
+    for(vector<OutgoingMessage>::iterator o = _batchTwowayRequests.begin(); o != _batchTwowayRequests.end(); ++o)
+    {
+        o->completed(*_exception);
+    }
+    _batchTwowayRequests.clear();
+
     for(map<Int, OutgoingAsyncBasePtr>::const_iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
     {
         if(q->second->exception(*_exception))
@@ -1954,7 +2143,9 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
                               const TransceiverPtr& transceiver,
                               const ConnectorPtr& connector,
                               const EndpointIPtr& endpoint,
-                              const ObjectAdapterIPtr& adapter) :
+                              const ObjectAdapterIPtr& adapter,
+                              const EndpointLoadPtr& endpointLoad,
+                              const CircuitBreakerPtr& circuitBreaker) :
     _communicator(communicator),
     _instance(instance),
     _monitor(monitor),
@@ -1963,6 +2154,8 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _type(transceiver->protocol()),
     _connector(connector),
     _endpoint(endpoint),
+    _endpointLoad(endpointLoad),
+    _circuitBreaker(circuitBreaker),
     _adapter(adapter),
     _dispatcher(_instance->initializationData().dispatcher), // Cached for better performance.
     _logger(_instance->initializationData().logger), // Cached for better performance.
@@ -1978,11 +2171,13 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _nextRequestId(1),
     _asyncRequestsHint(_asyncRequests.end()),
     _messageSizeMax(adapter ? adapter->messageSizeMax() : _instance->messageSizeMax()),
+    _maxDispatches(adapter ? adapter->maxDispatchesPerConnection() : 0),
     _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
     _readStream(_instance.get(), Ice::currentProtocolEncoding),
     _readHeader(false),
     _writeStream(_instance.get(), Ice::currentProtocolEncoding),
     _dispatchCount(0),
+    _readSuspended(false),
     _state(StateNotInitialized),
     _shutdownInitiated(false),
     _initialized(false),
@@ -2019,10 +2214,12 @@ Ice::ConnectionI::create(const CommunicatorPtr& communicator,
                          const TransceiverPtr& transceiver,
                          const ConnectorPtr& connector,
                          const EndpointIPtr& endpoint,
-                         const ObjectAdapterIPtr& adapter)
+                         const ObjectAdapterIPtr& adapter,
+                         const EndpointLoadPtr& endpointLoad,
+                         const CircuitBreakerPtr& circuitBreaker)
 {
     Ice::ConnectionIPtr conn(new ConnectionI(communicator, instance, monitor, transceiver, connector,
-                                             endpoint, adapter));
+                                             endpoint, adapter, endpointLoad, circuitBreaker));
     if(adapter)
     {
         const_cast<ThreadPoolPtr&>(conn->_threadPool) = adapter->getThreadPool();
@@ -2151,7 +2348,10 @@ Ice::ConnectionI::setState(State state)
                 {
                     return;
                 }
-                _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
+                if(!_readSuspended)
+                {
+                    _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
+                }
                 break;
             }
 
@@ -2359,6 +2559,23 @@ Ice::ConnectionI::heartbeat()
     }
 }
 
+void
+Ice::ConnectionI::resumeReading()
+{
+    //
+    // Must be called with the mutex locked once the number of
+    // dispatches in progress is below the limit again. Reading is
+    // resumed unless the connection is on hold, setState() takes
+    // care of it when the connection is activated again.
+    //
+    assert(_readSuspended && _state < StateClosed);
+    _readSuspended = false;
+    if(_state != StateHolding)
+    {
+        _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
+    }
+}
+
 bool
 Ice::ConnectionI::initialize(SocketOperation operation)
 {
@@ -2596,26 +2813,33 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             else
             {
 #endif
-                if(message->compress)
+                if(message->coalesced)
                 {
-                    //
-                    // Message not compressed. Request compressed response, if any.
-                    //
-                    message->stream->b[9] = 1;
+                    message->stream->i = message->stream->b.begin();
                 }
+                else
+                {
+                    if(message->compress)
+                    {
+                        //
+                        // Message not compressed. Request compressed response, if any.
+                        //
+                        message->stream->b[9] = 1;
+                    }
 
-                //
-                // No compression, just fill in the message size.
-                //
-                Int sz = static_cast<Int>(message->stream->b.size());
-                const Byte* p = reinterpret_cast<const Byte*>(&sz);
+                    //
+                    // No compression, just fill in the message size.
+                    //
+                    Int sz = static_cast<Int>(message->stream->b.size());
+                    const Byte* p = reinterpret_cast<const Byte*>(&sz);
 #ifdef ICE_BIG_ENDIAN
-                reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
+                    reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
 #else
-                copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
+                    copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
 #endif
-                message->stream->i = message->stream->b.begin();
-                traceSend(*message->stream, _logger, _traceLevels);
+                    message->stream->i = message->stream->b.begin();
+                    traceSend(*message->stream, _logger, _traceLevels);
+                }
 
 #ifdef ICE_HAS_BZIP2
             }
@@ -2665,6 +2889,90 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
     return SocketOperationNone;
 }
 
+void
+Ice::ConnectionI::flushBatchTwowayRequests(vector<OutgoingMessage>& sentCBs)
+{
+    //
+    // Assign the request IDs and write the queued requests back to back
+    // in a single stream, the requests are sent with a single write and
+    // the replies are dispatched to each request as usual. Coalesced
+    // requests aren't compressed.
+    //
+    OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
+    for(vector<OutgoingMessage>::iterator p = _batchTwowayRequests.begin(); p != _batchTwowayRequests.end(); ++p)
+    {
+        OutputStream* os = p->stream;
+
+        Int requestId = _nextRequestId++;
+        if(requestId <= 0)
+        {
+            _nextRequestId = 1;
+            requestId = _nextRequestId++;
+        }
+        p->requestId = requestId;
+
+        const Byte* q = reinterpret_cast<const Byte*>(&requestId);
+#ifdef ICE_BIG_ENDIAN
+        reverse_copy(q, q + sizeof(Int), os->b.begin() + headerSize);
+#else
+        copy(q, q + sizeof(Int), os->b.begin() + headerSize);
+#endif
+
+        if(p->compress)
+        {
+            os->b[9] = 1; // Message not compressed. Request compressed response, if any.
+        }
+
+        Int sz = static_cast<Int>(os->b.size());
+        q = reinterpret_cast<const Byte*>(&sz);
+#ifdef ICE_BIG_ENDIAN
+        reverse_copy(q, q + sizeof(Int), os->b.begin() + 10);
+#else
+        copy(q, q + sizeof(Int), os->b.begin() + 10);
+#endif
+        os->i = os->b.begin();
+        traceSend(*os, _logger, _traceLevels);
+
+        stream.writeBlob(&os->b[0], os->b.size());
+
+        p->outAsync->attachRemoteObserver(initConnectionInfo(), _endpoint, requestId);
+        _asyncRequestsHint = _asyncRequests.insert(_asyncRequests.end(),
+                                                   pair<const Int, OutgoingAsyncBasePtr>(requestId, p->outAsync));
+    }
+
+    try
+    {
+        OutgoingMessage message(&stream, false);
+        message.coalesced = true;
+        sendMessage(message);
+    }
+    catch(const LocalException& ex)
+    {
+        //
+        // The requests are failed with the connection exception, they
+        // weren't sent so they can be retried.
+        //
+        _batchTwowayRequests.clear();
+        setState(StateClosed, ex);
+        return;
+    }
+
+    //
+    // The requests are considered sent once handed over to the
+    // connection. This is conservative with respect to retries: a
+    // request still in the connection send queue isn't retried if the
+    // connection fails.
+    //
+    for(vector<OutgoingMessage>::iterator p = _batchTwowayRequests.begin(); p != _batchTwowayRequests.end(); ++p)
+    {
+        if(p->sent())
+        {
+            sentCBs.push_back(*p);
+        }
+    }
+    _batchTwowayRequests.clear();
+}
+
 AsyncStatus
 Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 {
@@ -2736,27 +3044,34 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     else
     {
 #endif
-        if(message.compress)
+        if(message.coalesced)
         {
-            //
-            // Message not compressed. Request compressed response, if any.
-            //
-            message.stream->b[9] = 1;
+            message.stream->i = message.stream->b.begin();
         }
+        else
+        {
+            if(message.compress)
+            {
+                //
+                // Message not compressed. Request compressed response, if any.
+                //
+                message.stream->b[9] = 1;
+            }
 
-        //
-        // No compression, just fill in the message size.
-        //
-        Int sz = static_cast<Int>(message.stream->b.size());
-        const Byte* p = reinterpret_cast<const Byte*>(&sz);
+            //
+            // No compression, just fill in the message size.
+            //
+            Int sz = static_cast<Int>(message.stream->b.size());
+            const Byte* p = reinterpret_cast<const Byte*>(&sz);
 #ifdef ICE_BIG_ENDIAN
-        reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+            reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
 #else
-        copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+            copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
 #endif
-        message.stream->i = message.stream->b.begin();
+            message.stream->i = message.stream->b.begin();
 
-        traceSend(*message.stream, _logger, _traceLevels);
+            traceSend(*message.stream, _logger, _traceLevels);
+        }
 
         //
         // Send the message without blocking.
@@ -3182,7 +3497,8 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
 
 void
 Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, Byte compress,
-                            const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter)
+                            const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
+                            const IceUtil::Time& received)
 {
     //
     // Note: In contrast to other private or protected methods, this
@@ -3204,9 +3520,18 @@ Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, B
             //
             // Dispatch the invocation.
             //
-            in.invoke(servantManager, &stream);
+            in.invoke(servantManager, &stream, received, invokeNum - 1);
+
+            //
+            // Requests of the batch dispatched along with this request
+            // don't have their own Incoming to release their dispatch.
+            //
+            for(Int i = 0; i < in.batchDispatched(); ++i)
+            {
+                sendNoResponse();
+            }
 
-            --invokeNum;
+            invokeNum -= 1 + in.batchDispatched();
         }
 
         stream.clear();
@@ -3217,6 +3542,88 @@ Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, B
     }
 }
 
+bool
+Ice::ConnectionI::queueRequest(InputStream& stream, Int requestId, Byte compress,
+                               const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
+                               const IceUtil::Time& received)
+{
+    //
+    // With admission control, the request is queued with the thread
+    // pool according to its priority class instead of being dispatched
+    // by this thread, which goes back to reading messages. The request
+    // is rejected right away if too many requests are already waiting
+    // to be dispatched. Requests aren't queued if the thread pool
+    // serializes the messages of the connection.
+    //
+    ObjectAdapterI* adapterI = dynamic_cast<ObjectAdapterI*>(adapter.get());
+    if(!adapterI || !adapterI->hasAdmissionControl() || _threadPool->serialize())
+    {
+        return false;
+    }
+
+    DispatchPriority priority;
+    try
+    {
+        InputStream::Container::iterator start = stream.i;
+        Identity ident;
+        stream.read(ident);
+        vector<string> facetPath;
+        stream.read(facetPath);
+        string operation;
+        stream.read(operation, false);
+        Context ctx;
+        if(!adapterI->getPriorityContext().empty())
+        {
+            Byte mode;
+            stream.read(mode);
+            stream.read(ctx);
+        }
+        stream.i = start;
+        priority = adapterI->getDispatchPriority(ident, operation, ctx);
+    }
+    catch(const LocalException&)
+    {
+        return false; // Let invokeAll() report the marshaling error.
+    }
+
+    if(!adapterI->queueDispatch(priority))
+    {
+        if(_traceLevels->protocol >= 1)
+        {
+            Trace out(_logger, _traceLevels->protocolCat);
+            out << "rejecting request, too many requests are waiting to be dispatched by object adapter `"
+                << adapter->getName() << "'\n" << _desc;
+        }
+
+        if(requestId == 0)
+        {
+            sendNoResponse();
+        }
+        else
+        {
+            OutputStream os(_instance.get(), currentProtocolEncoding);
+            os.writeBlob(replyHdr, sizeof(replyHdr));
+            os.write(requestId);
+            os.write(replyUnknownLocalException);
+            os.write("object adapter `" + adapter->getName() + "' is overloaded", false);
+            sendResponse(requestId, &os, compress, false);
+        }
+        return true;
+    }
+
+    try
+    {
+        _threadPool->dispatch(new QueuedDispatchCall(ICE_SHARED_FROM_THIS, compress, requestId, servantManager,
+                                                     adapter, stream, received), priority);
+    }
+    catch(const CommunicatorDestroyedException&)
+    {
+        adapterI->dequeueDispatch();
+        return false;
+    }
+    return true;
+}
+
 void
 Ice::ConnectionI::scheduleTimeout(SocketOperation status)
 {
@@ -27,6 +27,8 @@
 #include <Ice/ServantManagerF.h>
 #include <Ice/EndpointIF.h>
 #include <Ice/ConnectorF.h>
+#include <Ice/EndpointLoadF.h>
+#include <Ice/CircuitBreakerF.h>
 #include <Ice/LoggerF.h>
 #include <Ice/TraceLevelsF.h>
 #include <Ice/OutgoingAsync.h>
@@ -93,7 +95,7 @@ public:
     struct OutgoingMessage
     {
         OutgoingMessage(Ice::OutputStream* str, bool comp) :
-            stream(str), compress(comp), requestId(0), adopted(false)
+            stream(str), compress(comp), requestId(0), adopted(false), coalesced(false)
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -102,7 +104,7 @@ public:
 
         OutgoingMessage(const IceInternal::OutgoingAsyncBasePtr& o, Ice::OutputStream* str,
                         bool comp, int rid) :
-            stream(str), outAsync(o), compress(comp), requestId(rid), adopted(false)
+            stream(str), outAsync(o), compress(comp), requestId(rid), adopted(false), coalesced(false)
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -119,6 +121,7 @@ public:
         bool compress;
         int requestId;
         bool adopted;
+        bool coalesced; // The stream holds several messages, already prepared for sending.
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
         bool isSent;
         bool invokeSent;
@@ -172,6 +175,8 @@ public:
     void monitor(const IceUtil::Time&, const IceInternal::ACMConfig&);
 
     IceInternal::AsyncStatus sendAsyncRequest(const IceInternal::OutgoingAsyncBasePtr&, bool, bool, int);
+    IceInternal::AsyncStatus sendBatchTwowayRequest(const IceInternal::OutgoingAsyncBasePtr&, bool, bool);
+    void flushBatchTwowayRequests();
 
     IceInternal::BatchRequestQueuePtr getBatchRequestQueue() const;
 
@@ -207,6 +212,7 @@ public:
 
     IceInternal::EndpointIPtr endpoint() const;
     IceInternal::ConnectorPtr connector() const;
+    IceInternal::EndpointLoadPtr endpointLoad() const;
 
     virtual void setAdapter(const ObjectAdapterPtr&); // From Connection.
     virtual ObjectAdapterPtr getAdapter() const; // From Connection.
@@ -239,7 +245,7 @@ public:
     void dispatch(const StartCallbackPtr&, const std::vector<OutgoingMessage>&, Byte, Int, Int,
                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&,
                   const IceInternal::OutgoingAsyncBasePtr&,
-                  const ICE_HEARTBEAT_CALLBACK&, Ice::InputStream&);
+                  const ICE_HEARTBEAT_CALLBACK&, Ice::InputStream&, const IceUtil::Time&);
     void finish(bool);
 
     void closeCallback(const ICE_CLOSE_CALLBACK&);
@@ -250,12 +256,14 @@ private:
 
     ConnectionI(const Ice::CommunicatorPtr&, const IceInternal::InstancePtr&, const IceInternal::ACMMonitorPtr&,
                 const IceInternal::TransceiverPtr&, const IceInternal::ConnectorPtr&,
-                const IceInternal::EndpointIPtr&, const ObjectAdapterIPtr&);
+                const IceInternal::EndpointIPtr&, const ObjectAdapterIPtr&, const IceInternal::EndpointLoadPtr&,
+                const IceInternal::CircuitBreakerPtr&);
 
     static ConnectionIPtr
     create(const Ice::CommunicatorPtr&, const IceInternal::InstancePtr&, const IceInternal::ACMMonitorPtr&,
            const IceInternal::TransceiverPtr&, const IceInternal::ConnectorPtr&,
-           const IceInternal::EndpointIPtr&, const ObjectAdapterIPtr&);
+           const IceInternal::EndpointIPtr&, const ObjectAdapterIPtr&, const IceInternal::EndpointLoadPtr&,
+           const IceInternal::CircuitBreakerPtr&);
 
     enum State
     {
@@ -277,6 +285,7 @@ private:
 
     void initiateShutdown();
     void heartbeat();
+    void resumeReading();
 
     bool initialize(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     bool validate(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
@@ -293,7 +302,10 @@ private:
                                               IceInternal::OutgoingAsyncBasePtr&, ICE_HEARTBEAT_CALLBACK&, int&);
 
     void invokeAll(Ice::InputStream&, Int, Int, Byte,
-                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&);
+                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&, const IceUtil::Time&);
+
+    bool queueRequest(Ice::InputStream&, Int, Byte, const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&,
+                      const IceUtil::Time&);
 
     void scheduleTimeout(IceInternal::SocketOperation status);
     void unscheduleTimeout(IceInternal::SocketOperation status);
@@ -306,6 +318,8 @@ private:
 
     void reap();
 
+    void flushBatchTwowayRequests(std::vector<OutgoingMessage>&);
+
 #ifndef ICE_CPP11_MAPPING
     AsyncResultPtr __begin_flushBatchRequests(const IceInternal::CallbackBasePtr&, const LocalObjectPtr&);
 #endif
@@ -318,6 +332,8 @@ private:
     const std::string _type;
     const IceInternal::ConnectorPtr _connector;
     const IceInternal::EndpointIPtr _endpoint;
+    const IceInternal::EndpointLoadPtr _endpointLoad;
+    const IceInternal::CircuitBreakerPtr _circuitBreaker;
 
     mutable Ice::ConnectionInfoPtr _info;
 
@@ -352,9 +368,11 @@ private:
     IceUtil::UniquePtr<LocalException> _exception;
 
     const size_t _messageSizeMax;
+    const int _maxDispatches; // Stop reading once that many dispatches are in progress, 0 if unlimited.
     IceInternal::BatchRequestQueuePtr _batchRequestQueue;
 
     std::deque<OutgoingMessage> _sendStreams;
+    std::vector<OutgoingMessage> _batchTwowayRequests;
 
     Ice::InputStream _readStream;
     bool _readHeader;
@@ -363,6 +381,7 @@ private:
     Observer _observer;
 
     int _dispatchCount;
+    bool _readSuspended; // True if reading was suspended because _maxDispatches was reached.
 
     State _state; // The current state.
     bool _shutdownInitiated;
@@ -0,0 +1,119 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Deadline.h>
+#include <IceUtil/ThreadException.h>
+
+using namespace std;
+using namespace IceInternal;
+
+const char* const IceInternal::deadlineContextKey = "_deadline";
+
+#ifndef ICE_OS_WINRT
+namespace
+{
+
+//
+// The thread-specific key of the deadline of the request dispatched
+// by a thread. The key is never freed, it's a static variable.
+//
+#   ifdef _WIN32
+DWORD key;
+#   else
+pthread_key_t key;
+#   endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+#   ifdef _WIN32
+        key = TlsAlloc();
+        if(key == TLS_OUT_OF_INDEXES)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, GetLastError());
+        }
+#   else
+        int err = pthread_key_create(&key, 0);
+        if(err != 0)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, err);
+        }
+#   endif
+    }
+};
+
+Init init;
+
+const DispatchDeadline*
+getThreadDeadline()
+{
+#   ifdef _WIN32
+    return static_cast<const DispatchDeadline*>(TlsGetValue(key));
+#   else
+    return static_cast<const DispatchDeadline*>(pthread_getspecific(key));
+#   endif
+}
+
+void
+setThreadDeadline(const DispatchDeadline* deadline)
+{
+#   ifdef _WIN32
+    if(TlsSetValue(key, const_cast<DispatchDeadline*>(deadline)) == 0)
+    {
+        assert(false);
+    }
+#   else
+    if(pthread_setspecific(key, deadline) != 0)
+    {
+        assert(false);
+    }
+#   endif
+}
+
+}
+#endif
+
+IceUtil::Time
+IceInternal::getDispatchDeadline()
+{
+#ifndef ICE_OS_WINRT
+    const DispatchDeadline* deadline = getThreadDeadline();
+    if(deadline)
+    {
+        return deadline->_deadline;
+    }
+#endif
+    return IceUtil::Time();
+}
+
+IceInternal::DispatchDeadline::DispatchDeadline(const IceUtil::Time& deadline) :
+    _deadline(deadline),
+    _previous(0)
+{
+#ifndef ICE_OS_WINRT
+    if(_deadline != IceUtil::Time())
+    {
+        _previous = getThreadDeadline();
+        setThreadDeadline(this);
+    }
+#endif
+}
+
+IceInternal::DispatchDeadline::~DispatchDeadline()
+{
+#ifndef ICE_OS_WINRT
+    if(_deadline != IceUtil::Time())
+    {
+        setThreadDeadline(_previous);
+    }
+#endif
+}
@@ -0,0 +1,54 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_DEADLINE_H
+#define ICE_DEADLINE_H
+
+#include <IceUtil/Config.h>
+#include <IceUtil/Time.h>
+
+namespace IceInternal
+{
+
+//
+// The context key used to propagate the deadline of a request. The
+// value is the time remaining before the deadline in milliseconds.
+//
+extern const char* const deadlineContextKey;
+
+//
+// Returns the deadline of the request dispatched by the calling
+// thread, or a null time if the thread isn't dispatching a request
+// with a deadline. The deadline is a time of the monotonic clock.
+//
+IceUtil::Time getDispatchDeadline();
+
+//
+// Sets the deadline of the request dispatched by the calling thread
+// for the lifetime of the object, if not null. Invocations made by
+// the thread in the meantime inherit this deadline.
+//
+class DispatchDeadline : private IceUtil::noncopyable
+{
+public:
+
+    DispatchDeadline(const IceUtil::Time&);
+    ~DispatchDeadline();
+
+private:
+
+    friend IceUtil::Time getDispatchDeadline();
+
+    const IceUtil::Time _deadline;
+    const DispatchDeadline* _previous;
+};
+
+}
+
+#endif
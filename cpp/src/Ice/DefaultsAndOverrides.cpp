@@ -118,10 +118,14 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
     {
         defaultEndpointSelection = Ordered;
     }
+    else if(value == "Adaptive")
+    {
+        defaultEndpointSelection = Adaptive;
+    }
     else
     {
         EndpointSelectionTypeParseException ex(__FILE__, __LINE__);
-        ex.str = "illegal value `" + value + "'; expected `Random' or `Ordered'";
+        ex.str = "illegal value `" + value + "'; expected `Random', `Ordered' or `Adaptive'";
         throw ex;
     }
 
@@ -0,0 +1,95 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/EndpointLoad.h>
+
+using namespace std;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(EndpointLoad* p) { return p; }
+
+namespace
+{
+
+//
+// The weight of a new latency sample in the moving average.
+//
+const double latencyWeight = 0.25;
+
+//
+// How long an endpoint which couldn't be connected is only used if no
+// other endpoint is available. Its load is then estimated again from
+// scratch.
+//
+const IceUtil::Time connectionFailurePenalty = IceUtil::Time::seconds(5);
+
+}
+
+IceInternal::EndpointLoad::EndpointLoad() :
+    _outstanding(0),
+    _latency(0)
+{
+}
+
+void
+IceInternal::EndpointLoad::requestSent()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    ++_outstanding;
+}
+
+void
+IceInternal::EndpointLoad::requestCompleted(const IceUtil::Time& latency)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    assert(_outstanding > 0);
+    --_outstanding;
+
+    double sample = static_cast<double>(latency.toMicroSeconds());
+    if(_latency == 0)
+    {
+        _latency = sample;
+    }
+    else
+    {
+        _latency += latencyWeight * (sample - _latency);
+    }
+}
+
+void
+IceInternal::EndpointLoad::requestFailed()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    assert(_outstanding > 0);
+    --_outstanding;
+}
+
+void
+IceInternal::EndpointLoad::connectionFailed(const IceUtil::Time& now)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    _connectionFailure = now;
+    _latency = 0;
+}
+
+Ice::Long
+IceInternal::EndpointLoad::cost(const IceUtil::Time& now) const
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_connectionFailure != IceUtil::Time() && now - _connectionFailure < connectionFailurePenalty)
+    {
+        return ICE_INT64(0x7fffffffffffffff);
+    }
+
+    //
+    // The latency expected by a new request grows with the number of
+    // requests waiting for a reply ahead of it.
+    //
+    return static_cast<Ice::Long>(_latency * (_outstanding + 1)) + _outstanding;
+}
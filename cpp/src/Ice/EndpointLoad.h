@@ -0,0 +1,55 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ENDPOINT_LOAD_H
+#define ICE_ENDPOINT_LOAD_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/EndpointLoadF.h>
+#include <Ice/Config.h>
+
+namespace IceInternal
+{
+
+//
+// The load of an endpoint as observed by the invocations of proxies
+// configured with the Adaptive endpoint selection: the number of
+// outstanding requests sent over the connection to the endpoint and an
+// exponentially weighted moving average of the request latency.
+//
+class EndpointLoad : public IceUtil::Shared, public IceUtil::Mutex
+{
+public:
+
+    EndpointLoad();
+
+    void requestSent();
+    void requestCompleted(const IceUtil::Time&);
+    void requestFailed();
+    void connectionFailed(const IceUtil::Time&);
+
+    //
+    // The estimated cost of sending a request to the endpoint. Idle
+    // endpoints without latency samples cost nothing, endpoints which
+    // recently couldn't be connected cost the most.
+    //
+    Ice::Long cost(const IceUtil::Time&) const;
+
+private:
+
+    int _outstanding;
+    double _latency;
+    IceUtil::Time _connectionFailure;
+};
+
+}
+
+#endif
@@ -23,7 +23,10 @@
 #include <Ice/ReplyStatus.h>
 #include <Ice/ResponseHandler.h>
 #include <Ice/StringUtil.h>
+#include <Ice/Deadline.h>
+#include <IceUtil/InputUtil.h>
 #include <typeinfo>
+#include <cstring>
 
 using namespace std;
 using namespace Ice;
@@ -64,6 +67,7 @@ IceInternal::IncomingBase::IncomingBase(Instance* instance, ResponseHandler* res
     _current.con = connection;
 #endif
     _current.requestId = requestId;
+    _current.deadline = 0;
 }
 
 IceInternal::IncomingBase::IncomingBase(IncomingBase& other) :
@@ -166,6 +170,7 @@ IceInternal::IncomingBase::response(bool amd)
         assert(_responseHandler);
         if(_response)
         {
+            _observer.reallocated(_os.b.reallocations());
             _observer.reply(static_cast<Int>(_os.b.size() - headerSize - 4));
             _responseHandler->sendResponse(_current.requestId, &_os, _compress, amd);
         }
@@ -562,7 +567,11 @@ IceInternal::IncomingBase::handleException(const string& msg, bool amd)
 IceInternal::Incoming::Incoming(Instance* instance, ResponseHandler* responseHandler, Ice::Connection* connection,
                                 const ObjectAdapterPtr& adapter, bool response, Byte compress, Int requestId) :
     IncomingBase(instance, responseHandler, connection, adapter, response, compress, requestId),
-    _inParamPos(0)
+    _inParamPos(0),
+    _header(0),
+    _headerSize(0),
+    _batchRemaining(0),
+    _batchDispatched(0)
 {
 }
 
@@ -608,13 +617,35 @@ IceInternal::Incoming::startOver()
         _os.b.clear();
 
         _is->i = _inParamPos;
+        _batchDispatched = 0;
     }
 }
 
+bool
+IceInternal::Incoming::nextBatchRequest()
+{
+    //
+    // The next request of the batch is dispatched with this request if
+    // its header is identical: same identity, facet, operation, mode
+    // and context.
+    //
+    if(_batchDispatched == _batchRemaining ||
+       _is->b.end() - _is->i < _headerSize ||
+       memcmp(_is->i, _header, static_cast<size_t>(_headerSize)) != 0)
+    {
+        return false;
+    }
+    _is->i += _headerSize;
+    ++_batchDispatched;
+    return true;
+}
+
 void
-IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStream* stream)
+IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStream* stream,
+                              const IceUtil::Time& received, Int batchRemaining)
 {
     _is = stream;
+    _batchRemaining = batchRemaining;
 
     InputStream::Container::iterator start = _is->i;
 
@@ -656,6 +687,30 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
         _current.ctx.insert(_current.ctx.end(), pr);
     }
 
+    _header = start;
+    _headerSize = static_cast<Int>(_is->i - start);
+
+    //
+    // The received time is only set if deadline propagation is
+    // enabled. The deadline propagated by the caller is relative to
+    // the time the request was received.
+    //
+    IceUtil::Time deadline;
+    if(received != IceUtil::Time() && !_current.ctx.empty())
+    {
+        Context::iterator p = _current.ctx.find(deadlineContextKey);
+        if(p != _current.ctx.end())
+        {
+            IceUtil::Int64 remaining;
+            if(IceUtilInternal::stringToInt64(p->second, remaining))
+            {
+                deadline = received + IceUtil::Time::milliSeconds(remaining);
+                _current.deadline = deadline.toMilliSeconds();
+            }
+            _current.ctx.erase(p);
+        }
+    }
+
     const CommunicatorObserverPtr& obsv = _is->instance()->initializationData().observer;
     if(obsv)
     {
@@ -667,6 +722,28 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
         _observer.attach(obsv->getDispatchObserver(_current, static_cast<Int>(_is->i - start + sz)));
     }
 
+    //
+    // Drop the request if it expired while waiting to be dispatched,
+    // the caller already gave up on it so there's no reply to send.
+    //
+    if(deadline != IceUtil::Time() && IceUtil::Time::now(IceUtil::Time::Monotonic) >= deadline)
+    {
+        skipReadParams(); // Required for batch requests.
+        if(_observer)
+        {
+            _observer.failed(InvocationTimeoutException(__FILE__, __LINE__).ice_id());
+            _observer.detach();
+        }
+        _responseHandler->sendNoResponse();
+        _responseHandler = 0;
+        return;
+    }
+
+    //
+    // Invocations made while dispatching the request inherit its deadline.
+    //
+    DispatchDeadline dispatchDeadline(deadline);
+
     //
     // Don't put the code above into the try block below. Exceptions
     // in the code above are considered fatal, and must propagate to
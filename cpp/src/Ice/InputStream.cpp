@@ -24,6 +24,7 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/SlicedData.h>
 #include <Ice/StringConverter.h>
+#include <IceUtil/FileUtil.h>
 #include <iterator>
 
 #ifndef ICE_UNALIGNED
@@ -132,6 +133,14 @@ Ice::InputStream::InputStream(const CommunicatorPtr& communicator, const Encodin
     initialize(communicator, encoding);
 }
 
+Ice::InputStream::InputStream(const CommunicatorPtr& communicator, const EncodingVersion& encoding,
+                              const IceUtilInternal::MappedFilePtr& file) :
+    Buffer(file->begin(), file->end()),
+    _mappedFile(file)
+{
+    initialize(communicator, encoding);
+}
+
 Ice::InputStream::InputStream(Instance* instance, const EncodingVersion& encoding)
 {
     initialize(instance, encoding);
@@ -283,6 +292,7 @@ Ice::InputStream::swap(InputStream& other)
     std::swap(_valueFactoryManager, other._valueFactoryManager);
     std::swap(_logger, other._logger);
     std::swap(_compactIdResolver, other._compactIdResolver);
+    std::swap(_mappedFile, other._mappedFile);
 }
 
 void
@@ -24,6 +24,7 @@
 #include <Ice/Exception.h>
 #include <Ice/PropertiesI.h>
 #include <Ice/PropertiesAdminI.h>
+#include <Ice/CircuitBreakerAdminI.h>
 #include <Ice/LoggerI.h>
 #include <Ice/NetworkProxy.h>
 #include <Ice/EndpointFactoryManager.h>
@@ -947,7 +948,9 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
     _initData(initData),
     _messageSizeMax(0),
     _batchAutoFlushSize(0),
+    _batchAutoFlushDelay(0),
     _collectObjects(false),
+    _deadlinePropagation(false),
     _toStringMode(ICE_ENUM(ToStringMode, Unicode)),
     _implicitContext(0),
     _stringConverter(Ice::getProcessStringConverter()),
@@ -1188,8 +1191,14 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
             }
         }
 
+        const_cast<int&>(_batchAutoFlushDelay) =
+            max(_initData.properties->getPropertyAsInt("Ice.BatchAutoFlushDelay"), 0);
+
         const_cast<bool&>(_collectObjects) = _initData.properties->getPropertyAsInt("Ice.CollectObjects") > 0;
 
+        const_cast<bool&>(_deadlinePropagation) =
+            _initData.properties->getPropertyAsInt("Ice.DeadlinePropagation") > 0;
+
         string toStringModeStr = _initData.properties->getPropertyWithDefault("Ice.ToStringMode", "Unicode");
         if(toStringModeStr == "ASCII")
         {
@@ -1204,6 +1213,14 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
             throw InitializationException(__FILE__, __LINE__, "The value for Ice.ToStringMode must be Unicode, ASCII or Compat");
         }
 
+        Int retryBudget = _initData.properties->getPropertyAsInt("Ice.RetryBudget");
+        if(retryBudget > 0)
+        {
+            const_cast<RetryBudgetPtr&>(_retryBudget) =
+                new RetryBudget(retryBudget, _initData.properties->getPropertyAsIntWithDefault("Ice.RetryBudget.MinRetries",
+                                                                                             10));
+        }
+
 
         //
         // Client ACM enabled by default. Server ACM disabled by default.
@@ -1432,6 +1449,16 @@ IceInternal::Instance::finishSetup(int& argc, char* argv[], const Ice::Communica
 #endif
             }
         }
+
+        //
+        // CircuitBreaker facet, only if the circuit breakers are enabled
+        //
+        const string circuitBreakerFacetName = "CircuitBreaker";
+        if(_initData.properties->getPropertyAsInt("Ice.CircuitBreaker.FailureThreshold") > 0 &&
+           (_adminFacetFilter.empty() || _adminFacetFilter.find(circuitBreakerFacetName) != _adminFacetFilter.end()))
+        {
+            _adminFacets.insert(make_pair(circuitBreakerFacetName, ICE_MAKE_SHARED(CircuitBreakerAdminI, this)));
+        }
     }
 
     //
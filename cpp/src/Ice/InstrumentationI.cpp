@@ -825,6 +825,12 @@ DispatchObserverI::reply(Int size)
     }
 }
 
+void
+DispatchObserverI::reallocated(Int count)
+{
+    forEach(add(&DispatchMetrics::reallocations, count));
+}
+
 void
 RemoteObserverI::reply(Int size)
 {
@@ -865,6 +871,24 @@ InvocationObserverI::userException()
     }
 }
 
+void
+InvocationObserverI::reallocated(Int count)
+{
+    forEach(add(&InvocationMetrics::reallocations, count));
+}
+
+void
+InvocationObserverI::hedged()
+{
+    forEach(inc(&InvocationMetrics::hedged));
+}
+
+void
+InvocationObserverI::retryBudgetExhausted()
+{
+    forEach(inc(&InvocationMetrics::retryBudgetExhausted));
+}
+
 RemoteObserverPtr
 InvocationObserverI::getRemoteObserver(const ConnectionInfoPtr& connection,
                                        const EndpointPtr& endpoint,
@@ -916,7 +940,8 @@ CommunicatorObserverI::CommunicatorObserverI(const InitializationData& initData)
     _invocations(_metrics, "Invocation"),
     _threads(_metrics, "Thread"),
     _connects(_metrics, "ConnectionEstablishment"),
-    _endpointLookups(_metrics, "EndpointLookup")
+    _endpointLookups(_metrics, "EndpointLookup"),
+    _circuitBreakers(_metrics, "CircuitBreaker")
 {
     _invocations.registerSubMap<RemoteMetrics>("Remote", &InvocationMetrics::remotes);
     _invocations.registerSubMap<CollocatedMetrics>("Collocated", &InvocationMetrics::collocated);
@@ -1079,6 +1104,24 @@ CommunicatorObserverI::getDispatchObserver(const Current& current, int size)
     return ICE_NULLPTR;
 }
 
+ObserverPtr
+CommunicatorObserverI::getCircuitBreakerObserver(const EndpointPtr& endpt)
+{
+    if(_circuitBreakers.isEnabled())
+    {
+        try
+        {
+            return _circuitBreakers.getObserverWithDelegate(EndpointHelper(endpt), ObserverPtr());
+        }
+        catch(const exception& ex)
+        {
+            Error error(_metrics->getLogger());
+            error << "unexpected exception trying to obtain observer:\n" << ex;
+        }
+    }
+    return ICE_NULLPTR;
+}
+
 const IceInternal::MetricsAdminIPtr&
 CommunicatorObserverI::getFacet() const
 {
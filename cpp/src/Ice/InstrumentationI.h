@@ -11,6 +11,7 @@
 #define ICE_INSTRUMENTATION_I_H
 
 #include <Ice/MetricsObserverI.h>
+#include <Ice/ObserverHelper.h>
 #include <Ice/Connection.h>
 
 namespace IceInternal
@@ -167,13 +168,16 @@ public:
     virtual void stateChanged(Ice::Instrumentation::ThreadState, Ice::Instrumentation::ThreadState);
 };
 
-class DispatchObserverI : public ObserverWithDelegateT<IceMX::DispatchMetrics, Ice::Instrumentation::DispatchObserver>
+class DispatchObserverI : public ObserverWithDelegateT<IceMX::DispatchMetrics, Ice::Instrumentation::DispatchObserver>,
+                          public IceInternal::MarshalObserver
 {
 public:
 
     virtual void userException();
 
     virtual void reply(Ice::Int);
+
+    virtual void reallocated(Ice::Int);
 };
 
 class RemoteObserverI : public ObserverWithDelegateT<IceMX::RemoteMetrics, Ice::Instrumentation::RemoteObserver>
@@ -192,7 +196,10 @@ public:
 };
 
 class InvocationObserverI : public ObserverWithDelegateT<IceMX::InvocationMetrics,
-                                                         Ice::Instrumentation::InvocationObserver>
+                                                         Ice::Instrumentation::InvocationObserver>,
+                            public IceInternal::MarshalObserver,
+                            public IceInternal::HedgeObserver,
+                            public IceInternal::RetryBudgetObserver
 {
 public:
 
@@ -200,6 +207,12 @@ public:
 
     virtual void userException();
 
+    virtual void reallocated(Ice::Int);
+
+    virtual void hedged();
+
+    virtual void retryBudgetExhausted();
+
     virtual Ice::Instrumentation::RemoteObserverPtr
     getRemoteObserver(const Ice::ConnectionInfoPtr&, const Ice::EndpointPtr&, Ice::Int, Ice::Int);
 
@@ -238,6 +251,12 @@ public:
 
     virtual Ice::Instrumentation::DispatchObserverPtr getDispatchObserver(const Ice::Current&, Ice::Int);
 
+    //
+    // Not part of the CommunicatorObserver interface, the circuit
+    // breakers are only observed by the built-in metrics.
+    //
+    Ice::Instrumentation::ObserverPtr getCircuitBreakerObserver(const Ice::EndpointPtr&);
+
     const IceInternal::MetricsAdminIPtr& getFacet() const;
 
     void destroy();
@@ -253,6 +272,7 @@ private:
     ObserverFactoryWithDelegateT<ThreadObserverI> _threads;
     ObserverFactoryWithDelegateT<ObserverI> _connects;
     ObserverFactoryWithDelegateT<ObserverI> _endpointLookups;
+    ObserverFactoryWithDelegateT<ObserverI> _circuitBreakers;
 };
 ICE_DEFINE_PTR(CommunicatorObserverIPtr, CommunicatorObserverI);
 
@@ -40,12 +40,34 @@
 
 #include <iterator>
 
+#ifdef ICE_OS_WINRT
+#   include <thread>
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 
 namespace
 {
+
+//
+// Select the direct count stripe of the calling thread. The thread
+// identifiers are usually addresses, the bits which differ from one
+// thread to another are folded into the stripe index.
+//
+inline int directCountStripe(int stripes)
+{
+#if defined(ICE_OS_WINRT)
+    size_t h = hash<thread::id>()(this_thread::get_id());
+#elif defined(_WIN32)
+    size_t h = static_cast<size_t>(GetCurrentThreadId());
+#else
+    size_t h = (size_t)pthread_self();
+#endif
+    return static_cast<int>((h ^ (h >> 7) ^ (h >> 13) ^ (h >> 21)) & static_cast<size_t>(stripes - 1));
+}
+
 inline void checkIdentity(const Identity& ident)
 {
     if(ident.name.empty())
@@ -234,6 +256,7 @@ Ice::ObjectAdapterI::deactivate()
             return;
         }
         _state = StateDeactivating;
+        _deactivating.exchange(1);
     }
 
     //
@@ -309,7 +332,7 @@ Ice::ObjectAdapterI::waitForDeactivate()
         // Wait for deactivation of the adapter itself, and for
         // the return of all direct method calls using this adapter.
         //
-        while((_state < StateDeactivated) || _directCount > 0)
+        while((_state < StateDeactivated) || directCount() > 0)
         {
             wait();
         }
@@ -835,30 +858,101 @@ Ice::ObjectAdapterI::updateThreadObservers()
 void
 Ice::ObjectAdapterI::incDirectCount()
 {
-    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(*this);
-
-    checkForDeactivation();
+    //
+    // The count is incremented before checking for deactivation: either
+    // this thread sees the adapter deactivating or waitForDeactivate()
+    // sees the dispatch.
+    //
+    _directCount[directCountStripe(directCountStripes)].count.fetch_add(1);
+    if(_deactivating.load())
+    {
+        decDirectCount();
 
-    assert(_directCount >= 0);
-    ++_directCount;
+        IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(*this);
+        checkForDeactivation();
+    }
 }
 
 void
 Ice::ObjectAdapterI::decDirectCount()
 {
-    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(*this);
-
     // Not check for deactivation here!
 
     assert(_instance); // Must not be called after destroy().
 
-    assert(_directCount > 0);
-    if(--_directCount == 0)
+    _directCount[directCountStripe(directCountStripes)].count.fetch_sub(1);
+    if(_deactivating.load())
     {
-        notifyAll();
+        IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(*this);
+        assert(directCount() >= 0);
+        if(directCount() == 0)
+        {
+            notifyAll();
+        }
     }
 }
 
+DispatchPriority
+Ice::ObjectAdapterI::getDispatchPriority(const Identity& ident, const string& operation, const Context& ctx) const
+{
+    //
+    // No mutex lock necessary, the admission control configuration is
+    // immutable. The priority from the request context has precedence
+    // over the operation and identity category priorities.
+    //
+    if(!_priorityContext.empty())
+    {
+        Context::const_iterator p = ctx.find(_priorityContext);
+        if(p != ctx.end())
+        {
+            if(p->second == "high")
+            {
+                return DispatchPriorityHigh;
+            }
+            else if(p->second == "low")
+            {
+                return DispatchPriorityLow;
+            }
+            return DispatchPriorityNormal;
+        }
+    }
+
+    if(_highPriorityOperations.find(operation) != _highPriorityOperations.end() ||
+       _highPriorityCategories.find(ident.category) != _highPriorityCategories.end())
+    {
+        return DispatchPriorityHigh;
+    }
+    else if(_lowPriorityOperations.find(operation) != _lowPriorityOperations.end() ||
+            _lowPriorityCategories.find(ident.category) != _lowPriorityCategories.end())
+    {
+        return DispatchPriorityLow;
+    }
+    return DispatchPriorityNormal;
+}
+
+bool
+Ice::ObjectAdapterI::queueDispatch(DispatchPriority priority)
+{
+    //
+    // Returns false if the maximum number of queued dispatches is
+    // reached, the request is rejected. High priority requests are
+    // always admitted.
+    //
+    if(_queuedDispatches.fetch_add(1) >= _maxQueuedDispatches && _maxQueuedDispatches > 0 &&
+       priority != DispatchPriorityHigh)
+    {
+        _queuedDispatches.fetch_sub(1);
+        return false;
+    }
+    return true;
+}
+
+void
+Ice::ObjectAdapterI::dequeueDispatch()
+{
+    _queuedDispatches.fetch_sub(1);
+}
+
 ThreadPoolPtr
 Ice::ObjectAdapterI::getThreadPool() const
 {
@@ -912,9 +1006,13 @@ Ice::ObjectAdapterI::ObjectAdapterI(const InstancePtr& instance, const Communica
     _objectAdapterFactory(objectAdapterFactory),
     _servantManager(new ServantManager(instance, name)),
     _name(name),
-    _directCount(0),
+    _deactivating(0),
     _noConfig(noConfig),
-    _messageSizeMax(0)
+    _messageSizeMax(0),
+    _maxDispatchesPerConnection(0),
+    _admissionControl(false),
+    _maxQueuedDispatches(0),
+    _queuedDispatches(0)
 {
 }
 
@@ -992,6 +1090,26 @@ Ice::ObjectAdapterI::initialize(const RouterPrxPtr& router)
             }
         }
 
+        _maxDispatchesPerConnection = max(properties->getPropertyAsInt(_name + ".MaxDispatchesPerConnection"), 0);
+
+        {
+            _maxQueuedDispatches = max(properties->getPropertyAsInt(_name + ".MaxQueuedDispatches"), 0);
+            _priorityContext = properties->getProperty(_name + ".Priority.Context");
+
+            StringSeq v = properties->getPropertyAsList(_name + ".Priority.HighOperations");
+            _highPriorityOperations.insert(v.begin(), v.end());
+            v = properties->getPropertyAsList(_name + ".Priority.HighCategories");
+            _highPriorityCategories.insert(v.begin(), v.end());
+            v = properties->getPropertyAsList(_name + ".Priority.LowOperations");
+            _lowPriorityOperations.insert(v.begin(), v.end());
+            v = properties->getPropertyAsList(_name + ".Priority.LowCategories");
+            _lowPriorityCategories.insert(v.begin(), v.end());
+
+            _admissionControl = _maxQueuedDispatches > 0 || !_priorityContext.empty() ||
+                !_highPriorityOperations.empty() || !_highPriorityCategories.empty() ||
+                !_lowPriorityOperations.empty() || !_lowPriorityCategories.empty();
+        }
+
         int threadPoolSize = properties->getPropertyAsInt(_name + ".ThreadPool.Size");
         int threadPoolSizeMax = properties->getPropertyAsInt(_name + ".ThreadPool.SizeMax");
         bool hasPriority = properties->getProperty(_name + ".ThreadPool.ThreadPriority") != "";
@@ -1114,7 +1232,7 @@ Ice::ObjectAdapterI::~ObjectAdapterI()
         //assert(!_servantManager); // We don't clear this reference, it needs to be immutable.
         assert(!_threadPool);
         assert(_incomingConnectionFactories.empty());
-        assert(_directCount == 0);
+        assert(directCount() == 0);
     }
 }
 
@@ -1179,6 +1297,17 @@ Ice::ObjectAdapterI::checkForDeactivation() const
     }
 }
 
+int
+Ice::ObjectAdapterI::directCount() const
+{
+    int count = 0;
+    for(int i = 0; i < directCountStripes; ++i)
+    {
+        count += _directCount[i].count.load();
+    }
+    return count;
+}
+
 vector<EndpointIPtr>
 Ice::ObjectAdapterI::parseEndpoints(const string& endpts, bool oaEndpoints) const
 {
@@ -1419,7 +1548,14 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "Locator.PreferSecure",
         "Locator.CollocationOptimized",
         "Locator.Router",
+        "MaxDispatchesPerConnection",
+        "MaxQueuedDispatches",
         "MessageSizeMax",
+        "Priority.Context",
+        "Priority.HighCategories",
+        "Priority.HighOperations",
+        "Priority.LowCategories",
+        "Priority.LowOperations",
         "PublishedEndpoints",
         "ReplicaGroupId",
         "Router",
@@ -13,6 +13,7 @@
 #include <IceUtil/Shared.h>
 #include <IceUtil/RecMutex.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Atomic.h>
 #include <Ice/ObjectAdapter.h>
 #include <Ice/InstanceF.h>
 #include <Ice/ObjectAdapterFactoryF.h>
@@ -24,13 +25,14 @@
 #include <Ice/RouterInfoF.h>
 #include <Ice/EndpointIF.h>
 #include <Ice/LocatorInfoF.h>
-#include <Ice/ThreadPoolF.h>
+#include <Ice/ThreadPool.h>
 #include <Ice/OutgoingAsyncF.h>
 #include <Ice/Exception.h>
 #include <Ice/BuiltinSequences.h>
 #include <Ice/Proxy.h>
 #include <Ice/ACM.h>
 #include <list>
+#include <set>
 
 namespace Ice
 {
@@ -104,6 +106,13 @@ public:
     IceInternal::ServantManagerPtr getServantManager() const;
     IceInternal::ACMConfig getACM() const;
     size_t messageSizeMax() const { return _messageSizeMax; }
+    int maxDispatchesPerConnection() const { return _maxDispatchesPerConnection; }
+
+    bool hasAdmissionControl() const { return _admissionControl; }
+    const std::string& getPriorityContext() const { return _priorityContext; }
+    IceInternal::DispatchPriority getDispatchPriority(const Identity&, const std::string&, const Context&) const;
+    bool queueDispatch(IceInternal::DispatchPriority);
+    void dequeueDispatch();
 
     ObjectAdapterI(const IceInternal::InstancePtr&, const CommunicatorPtr&,
                    const IceInternal::ObjectAdapterFactoryPtr&, const std::string&, bool);
@@ -118,6 +127,7 @@ private:
     ObjectPrxPtr newDirectProxy(const Identity&, const std::string&) const;
     ObjectPrxPtr newIndirectProxy(const Identity&, const std::string&, const std::string&) const;
     void checkForDeactivation() const;
+    int directCount() const;
     std::vector<IceInternal::EndpointIPtr> parseEndpoints(const std::string&, bool) const;
     std::vector<IceInternal::EndpointIPtr> parsePublishedEndpoints();
     void updateLocatorRegistry(const IceInternal::LocatorInfoPtr&, const Ice::ObjectPrxPtr&);
@@ -150,9 +160,45 @@ private:
     IceInternal::RouterInfoPtr _routerInfo;
     std::vector<IceInternal::EndpointIPtr> _publishedEndpoints;
     IceInternal::LocatorInfoPtr _locatorInfo;
-    int _directCount; // The number of direct proxies dispatching on this object adapter.
+
+    //
+    // The number of direct proxies dispatching on this object adapter.
+    // The count is striped over cache lines selected by the calling
+    // thread so that dispatches don't lock the adapter. A dispatch
+    // might be counted by a thread and released by another, only the
+    // sum of the stripes is meaningful. The adapter monitor is only
+    // locked by decDirectCount() once the adapter is deactivating, to
+    // wake up waitForDeactivate().
+    //
+    struct DirectCountStripe
+    {
+        DirectCountStripe() : count(0)
+        {
+        }
+
+        IceUtilInternal::Atomic count;
+        char pad[64 - sizeof(IceUtilInternal::Atomic)];
+    };
+    static const int directCountStripes = 16; // Must be a power of 2.
+    DirectCountStripe _directCount[directCountStripes];
+    IceUtilInternal::Atomic _deactivating; // Set with the monitor locked once the state is StateDeactivating.
     bool _noConfig;
     size_t _messageSizeMax;
+    int _maxDispatchesPerConnection;
+
+    //
+    // Admission control of the requests received over the incoming
+    // connections, see ConnectionI::message(). The configuration is
+    // immutable after initialize().
+    //
+    bool _admissionControl;
+    int _maxQueuedDispatches;
+    std::string _priorityContext;
+    std::set<std::string> _highPriorityOperations;
+    std::set<std::string> _highPriorityCategories;
+    std::set<std::string> _lowPriorityOperations;
+    std::set<std::string> _lowPriorityCategories;
+    IceUtilInternal::Atomic _queuedDispatches;
 };
 
 }
@@ -16,6 +16,21 @@ using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
 
+IceInternal::MarshalObserver::~MarshalObserver()
+{
+    // Out of line to avoid weak vtable
+}
+
+IceInternal::HedgeObserver::~HedgeObserver()
+{
+    // Out of line to avoid weak vtable
+}
+
+IceInternal::RetryBudgetObserver::~RetryBudgetObserver()
+{
+    // Out of line to avoid weak vtable
+}
+
 IceInternal::InvocationObserver::InvocationObserver(const Ice::ObjectPrxPtr& proxy, const string& op, const Context& ctx)
 {
     const CommunicatorObserverPtr& obsv = proxy->__reference()->getInstance()->initializationData().observer;
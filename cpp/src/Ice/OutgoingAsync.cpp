@@ -19,7 +19,12 @@
 #include <Ice/RetryQueue.h>
 #include <Ice/ConnectionFactory.h>
 #include <Ice/ObjectAdapterFactory.h>
+#include <Ice/ProxyFactory.h>
+#include <Ice/EndpointI.h>
+#include <Ice/EndpointLoad.h>
 #include <Ice/LoggerUtil.h>
+#include <Ice/TraceLevels.h>
+#include <Ice/Deadline.h>
 
 using namespace std;
 using namespace Ice;
@@ -567,6 +572,7 @@ OutgoingAsyncBase::warning() const
 bool
 ProxyOutgoingAsyncBase::exception(const Exception& exc)
 {
+    loadCompleted(false);
     if(_childObserver)
     {
         _childObserver.failed(exc.ice_id());
@@ -590,7 +596,7 @@ ProxyOutgoingAsyncBase::exception(const Exception& exc)
         // the retry interval is 0. This method can be called with the
         // connection locked so we can't just retry here.
         //
-        _instance->retryQueue()->add(ICE_SHARED_FROM_THIS, _proxy->__handleException(exc, _handler, _mode, _sent, _cnt));
+        _instance->retryQueue()->add(ICE_SHARED_FROM_THIS, checkRetry(exc));
         return false;
     }
     catch(const Exception& ex)
@@ -697,10 +703,21 @@ ProxyOutgoingAsyncBase::invokeImpl(bool userThread)
         if(userThread)
         {
             int invocationTimeout = _proxy->__reference()->getInvocationTimeout();
-            if(invocationTimeout > 0)
+            if(_deadline != IceUtil::Time())
+            {
+                _instance->timer()->schedule(ICE_SHARED_FROM_THIS,
+                                             _deadline - IceUtil::Time::now(IceUtil::Time::Monotonic));
+            }
+            else if(invocationTimeout > 0)
             {
                 _instance->timer()->schedule(ICE_SHARED_FROM_THIS, IceUtil::Time::milliSeconds(invocationTimeout));
             }
+
+            RetryBudgetPtr retryBudget = _instance->retryBudget();
+            if(retryBudget)
+            {
+                retryBudget->invoked();
+            }
         }
         else
         {
@@ -736,16 +753,18 @@ ProxyOutgoingAsyncBase::invokeImpl(bool userThread)
             }
             catch(const RetryException&)
             {
+                loadCompleted(false);
                 _proxy->__updateRequestHandler(_handler, 0); // Clear request handler and always retry.
             }
             catch(const Exception& ex)
             {
+                loadCompleted(false);
                 if(_childObserver)
                 {
                     _childObserver.failed(ex.ice_id());
                     _childObserver.detach();
                 }
-                int interval = _proxy->__handleException(ex, _handler, _mode, _sent, _cnt);
+                int interval = checkRetry(ex);
                 if(interval > 0)
                 {
                     _instance->retryQueue()->add(ICE_SHARED_FROM_THIS, interval);
@@ -781,7 +800,7 @@ ProxyOutgoingAsyncBase::sentImpl(bool done)
     _sent = true;
     if(done)
     {
-        if(_proxy->__reference()->getInvocationTimeout() != -1)
+        if(_proxy->__reference()->getInvocationTimeout() != -1 || _deadline != IceUtil::Time())
         {
             _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
         }
@@ -792,7 +811,8 @@ ProxyOutgoingAsyncBase::sentImpl(bool done)
 bool
 ProxyOutgoingAsyncBase::exceptionImpl(const Exception& ex)
 {
-    if(_proxy->__reference()->getInvocationTimeout() != -1)
+    loadCompleted(false);
+    if(_proxy->__reference()->getInvocationTimeout() != -1 || _deadline != IceUtil::Time())
     {
         _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
     }
@@ -802,13 +822,72 @@ ProxyOutgoingAsyncBase::exceptionImpl(const Exception& ex)
 bool
 ProxyOutgoingAsyncBase::responseImpl(bool ok)
 {
-    if(_proxy->__reference()->getInvocationTimeout() != -1)
+    loadCompleted(true);
+    if(_proxy->__reference()->getInvocationTimeout() != -1 || _deadline != IceUtil::Time())
     {
         _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
     }
     return OutgoingAsyncBase::responseImpl(ok);
 }
 
+int
+ProxyOutgoingAsyncBase::checkRetry(const Exception& exc)
+{
+    int interval = _proxy->__handleException(exc, _handler, _mode, _sent, _cnt);
+
+    //
+    // The retry is allowed, check that the retry budget of the
+    // communicator isn't exhausted.
+    //
+    RetryBudgetPtr retryBudget = _instance->retryBudget();
+    if(retryBudget && !retryBudget->retry())
+    {
+        _observer.retryBudgetExhausted();
+        if(_instance->traceLevels()->retry >= 1)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->retryCat);
+            out << "operation retry canceled because the retry budget is exhausted\n" << exc;
+        }
+        exc.ice_throw();
+    }
+    return interval;
+}
+
+void
+ProxyOutgoingAsyncBase::loadSent(const ConnectionIPtr& connection)
+{
+    //
+    // Account for the request in the load of the connection endpoint,
+    // this must be done before the request is sent since the reply can
+    // be received by another thread before sendAsyncRequest returns.
+    //
+    EndpointLoadPtr load = connection->endpointLoad();
+    if(load)
+    {
+        load->requestSent();
+        _loadConnection = connection;
+        _loadSentTime = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    }
+}
+
+void
+ProxyOutgoingAsyncBase::loadCompleted(bool response)
+{
+    if(_loadConnection)
+    {
+        EndpointLoadPtr load = _loadConnection->endpointLoad();
+        if(response)
+        {
+            load->requestCompleted(IceUtil::Time::now(IceUtil::Time::Monotonic) - _loadSentTime);
+        }
+        else
+        {
+            load->requestFailed();
+        }
+        _loadConnection = 0;
+    }
+}
+
 void
 ProxyOutgoingAsyncBase::runTimerTask()
 {
@@ -822,10 +901,466 @@ ProxyOutgoingAsyncBase::runTimerTask()
     }
 }
 
+namespace IceInternal
+{
+
+class HedgedInvocation;
+ICE_DEFINE_PTR(HedgedInvocationPtr, HedgedInvocation);
+
+//
+// A copy of the request of a hedged invocation. The completion of the
+// request is reported to the hedged invocation rather than to the
+// application.
+//
+class HedgedRequest : public OutgoingAsync
+{
+public:
+
+    HedgedRequest(const ObjectPrxPtr&, const OutgoingAsyncPtr&, const HedgedInvocationPtr&, bool);
+
+    void send(bool userThread)
+    {
+        invokeImpl(userThread);
+    }
+
+    void cancelRequest(const LocalException& ex)
+    {
+        cancel(ex);
+    }
+
+protected:
+
+    virtual bool handleSent(bool, bool);
+    virtual bool handleException(const Exception&);
+    virtual bool handleResponse(bool);
+
+    virtual void handleInvokeSent(bool, OutgoingAsyncBase*) const;
+    virtual void handleInvokeException(const Exception&, OutgoingAsyncBase*) const;
+    virtual void handleInvokeResponse(bool, OutgoingAsyncBase*) const;
+
+    virtual InvocationObserver& getObserver();
+
+private:
+
+    const HedgedInvocationPtr _invocation;
+};
+ICE_DEFINE_PTR(HedgedRequestPtr, HedgedRequest);
+
+//
+// Sends the request of an idempotent invocation and, if no reply is
+// received within the proxy's hedge delay, sends up to the proxy's
+// maximum number of hedged requests, each over its own connection. The
+// first reply completes the invocation and the other requests are
+// canceled.
+//
+class HedgedInvocation : public IceUtil::TimerTask,
+                         public CancellationHandler
+#ifdef ICE_CPP11_MAPPING
+                       , public std::enable_shared_from_this<HedgedInvocation>
+#endif
+{
+public:
+
+    HedgedInvocation(const OutgoingAsyncPtr&, const ObjectPrxPtr&);
+
+    void invoke();
+
+    void sent(const ConnectionPtr&);
+    void exception(HedgedRequest*, const Exception&);
+    void response(HedgedRequest*, const ConnectionPtr&, bool);
+
+    InvocationObserver& getObserver()
+    {
+        return _outAsync->_observer;
+    }
+
+    virtual void runTimerTask();
+    virtual void asyncRequestCanceled(const OutgoingAsyncBasePtr&, const LocalException&);
+
+private:
+
+    void remove(HedgedRequest*);
+    void schedule(const IceUtil::Time&);
+    void cancelTimer();
+    ObjectPrxPtr getHedgeProxy(int) const;
+
+    const OutgoingAsyncPtr _outAsync;
+    const InstancePtr _instance;
+    const ObjectPrxPtr _proxy;
+    const IceUtil::Time _delay;
+    const int _max;
+
+    IceUtil::Mutex _mutex;
+    vector<HedgedRequestPtr> _requests;
+    int _hedged;
+    bool _sent;
+    bool _completed;
+    bool _canceled;
+};
+
+}
+
+HedgedRequest::HedgedRequest(const ObjectPrxPtr& proxy,
+                             const OutgoingAsyncPtr& outAsync,
+                             const HedgedInvocationPtr& invocation,
+                             bool synchronous) :
+    OutgoingAsync(proxy, synchronous),
+    _invocation(invocation)
+{
+    _mode = outAsync->_mode;
+    _os.writeBlob(outAsync->_os.b.begin(), outAsync->_os.b.size());
+}
+
+bool
+HedgedRequest::handleSent(bool, bool alreadySent)
+{
+    if(!alreadySent)
+    {
+        _invocation->sent(_cachedConnection);
+    }
+    return false;
+}
+
+bool
+HedgedRequest::handleException(const Exception& ex)
+{
+    _invocation->exception(this, ex);
+    return false;
+}
+
+bool
+HedgedRequest::handleResponse(bool ok)
+{
+    _invocation->response(this, _cachedConnection, ok);
+    return false;
+}
+
+void
+HedgedRequest::handleInvokeSent(bool, OutgoingAsyncBase*) const
+{
+    assert(false); // The hedged invocation notifies the application.
+}
+
+void
+HedgedRequest::handleInvokeException(const Exception&, OutgoingAsyncBase*) const
+{
+    assert(false);
+}
+
+void
+HedgedRequest::handleInvokeResponse(bool, OutgoingAsyncBase*) const
+{
+    assert(false);
+}
+
+InvocationObserver&
+HedgedRequest::getObserver()
+{
+    //
+    // The remote observers of the requests are attached to the
+    // invocation observer of the hedged invocation.
+    //
+    return _invocation->getObserver();
+}
+
+HedgedInvocation::HedgedInvocation(const OutgoingAsyncPtr& outAsync, const ObjectPrxPtr& proxy) :
+    _outAsync(outAsync),
+    _instance(outAsync->_instance),
+    _proxy(proxy),
+    _delay(IceUtil::Time::milliSeconds(proxy->__reference()->getHedgeDelay())),
+    _max(proxy->__reference()->getHedgeMax()),
+    _hedged(0),
+    _sent(false),
+    _completed(false),
+    _canceled(false)
+{
+}
+
+void
+HedgedInvocation::invoke()
+{
+    HedgedRequestPtr request = ICE_MAKE_SHARED(HedgedRequest, _proxy, _outAsync, ICE_SHARED_FROM_THIS,
+                                               _outAsync->_synchronous);
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        _requests.push_back(request);
+    }
+
+    try
+    {
+        _outAsync->OutgoingAsyncBase::cancelable(ICE_SHARED_FROM_THIS);
+        request->send(true);
+    }
+    catch(const Exception&)
+    {
+        //
+        // The caller aborts the invocation.
+        //
+        IceUtil::Mutex::Lock sync(_mutex);
+        _completed = true;
+        _requests.clear();
+        throw;
+    }
+
+    IceUtil::Mutex::Lock sync(_mutex);
+    if(!_completed)
+    {
+        schedule(_delay);
+    }
+}
+
+void
+HedgedInvocation::sent(const ConnectionPtr& connection)
+{
+    //
+    // The invocation is sent once its first request is sent. This is
+    // called with the mutex of the request locked and possibly with
+    // its connection locked, callbacks are invoked asynchronously.
+    //
+    bool invokeSent;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_sent || _completed)
+        {
+            return;
+        }
+        _sent = true;
+        if(!_outAsync->_cachedConnection)
+        {
+            _outAsync->_cachedConnection = connection;
+        }
+        invokeSent = _outAsync->sent();
+    }
+
+    if(invokeSent)
+    {
+        _outAsync->invokeSentAsync();
+    }
+}
+
+void
+HedgedInvocation::exception(HedgedRequest* request, const Exception& ex)
+{
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        remove(request);
+        if(_completed || !_requests.empty())
+        {
+            return; // Wait for the reply of another request.
+        }
+        _completed = true;
+        cancelTimer();
+    }
+
+    if(_outAsync->exceptionImpl(ex))
+    {
+        _outAsync->invokeExceptionAsync();
+    }
+}
+
+void
+HedgedInvocation::response(HedgedRequest* request, const ConnectionPtr& connection, bool ok)
+{
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_completed)
+        {
+            return;
+        }
+        _completed = true;
+        remove(request);
+        if(!_outAsync->_cachedConnection)
+        {
+            _outAsync->_cachedConnection = connection;
+        }
+
+        //
+        // The other requests are canceled from the timer thread, the
+        // connection of this request might be locked.
+        //
+        if(_requests.empty())
+        {
+            cancelTimer();
+        }
+        else
+        {
+            schedule(IceUtil::Time());
+        }
+    }
+
+    _outAsync->_is.swap(*request->getIs());
+    if(!ok)
+    {
+        _outAsync->_observer.userException();
+    }
+    if(_outAsync->responseImpl(ok))
+    {
+        _outAsync->invokeResponseAsync();
+    }
+}
+
+void
+HedgedInvocation::runTimerTask()
+{
+    vector<HedgedRequestPtr> canceled;
+    int hedge = 0;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_completed)
+        {
+            canceled.swap(_requests);
+        }
+        else if(!_canceled && _hedged < _max)
+        {
+            hedge = ++_hedged;
+            if(_hedged < _max)
+            {
+                schedule(_delay);
+            }
+        }
+    }
+
+    for(vector<HedgedRequestPtr>::const_iterator p = canceled.begin(); p != canceled.end(); ++p)
+    {
+        (*p)->cancelRequest(InvocationCanceledException(__FILE__, __LINE__));
+    }
+
+    if(hedge > 0)
+    {
+        HedgedRequestPtr request = ICE_MAKE_SHARED(HedgedRequest, getHedgeProxy(hedge), _outAsync,
+                                                   ICE_SHARED_FROM_THIS, false);
+        {
+            IceUtil::Mutex::Lock sync(_mutex);
+            if(_completed || _canceled)
+            {
+                return;
+            }
+            _requests.push_back(request);
+        }
+
+        _outAsync->_observer.hedged();
+        try
+        {
+            request->send(false);
+        }
+        catch(const CommunicatorDestroyedException&)
+        {
+            // The exception callback couldn't be dispatched, ignore.
+        }
+    }
+}
+
+void
+HedgedInvocation::asyncRequestCanceled(const OutgoingAsyncBasePtr&, const LocalException& ex)
+{
+    //
+    // The invocation was canceled or its invocation timeout expired,
+    // the invocation fails with the exception of the last request.
+    //
+    vector<HedgedRequestPtr> requests;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_completed || _canceled)
+        {
+            return;
+        }
+        _canceled = true;
+        cancelTimer();
+        requests = _requests;
+    }
+
+    for(vector<HedgedRequestPtr>::const_iterator p = requests.begin(); p != requests.end(); ++p)
+    {
+        (*p)->cancelRequest(ex);
+    }
+}
+
+void
+HedgedInvocation::remove(HedgedRequest* request)
+{
+    // Must be called with the mutex locked.
+    for(vector<HedgedRequestPtr>::iterator p = _requests.begin(); p != _requests.end(); ++p)
+    {
+        if(p->get() == request)
+        {
+            _requests.erase(p);
+            return;
+        }
+    }
+}
+
+void
+HedgedInvocation::schedule(const IceUtil::Time& delay)
+{
+    // Must be called with the mutex locked.
+    try
+    {
+        IceUtil::TimerPtr timer = _instance->timer();
+        timer->cancel(ICE_SHARED_FROM_THIS);
+        timer->schedule(ICE_SHARED_FROM_THIS, delay);
+    }
+    catch(const CommunicatorDestroyedException&)
+    {
+        // The requests fail with the communicator destruction.
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+        // Timer destroyed.
+    }
+}
+
+void
+HedgedInvocation::cancelTimer()
+{
+    // Must be called with the mutex locked.
+    try
+    {
+        _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+    }
+    catch(const CommunicatorDestroyedException&)
+    {
+    }
+}
+
+ObjectPrxPtr
+HedgedInvocation::getHedgeProxy(int hedge) const
+{
+    //
+    // Each hedged request uses its own connection. If the proxy has
+    // several endpoints, the endpoint of the first request's connection
+    // is skipped and the hedged requests start with the following
+    // endpoints.
+    //
+    ReferencePtr ref = _proxy->__reference();
+    vector<EndpointIPtr> endpoints = ref->getEndpoints();
+    if(endpoints.size() > 1)
+    {
+        ConnectionIPtr connection = ICE_DYNAMIC_CAST(ConnectionI, _proxy->ice_getCachedConnection());
+        if(connection)
+        {
+            for(vector<EndpointIPtr>::iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+            {
+                if((*p)->equivalent(connection->endpoint()))
+                {
+                    endpoints.erase(p);
+                    break;
+                }
+            }
+        }
+        rotate(endpoints.begin(), endpoints.begin() + (hedge - 1) % endpoints.size(), endpoints.end());
+        ref = ref->changeEndpoints(endpoints)->changeEndpointSelection(ICE_ENUM(EndpointSelectionType, Ordered));
+    }
+
+    ostringstream os;
+    os << ref->getConnectionId() << "-hedge" << hedge;
+    return _instance->proxyFactory()->referenceToProxy(ref->changeConnectionId(os.str()));
+}
+
 OutgoingAsync::OutgoingAsync(const ObjectPrxPtr& prx, bool synchronous) :
     ProxyOutgoingAsyncBase(prx),
     _encoding(getCompatibleEncoding(prx->__reference()->getEncoding())),
-    _synchronous(synchronous)
+    _synchronous(synchronous),
+    _batchTwowayQueued(false)
 {
 }
 
@@ -876,12 +1411,52 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
 
     _os.write(static_cast<Byte>(_mode));
 
+    //
+    // With deadline propagation, the deadline of the invocation is the
+    // earliest of the deadline of the request dispatched by the calling
+    // thread and of the invocation timeout. The time remaining before
+    // the deadline is sent with the request context.
+    //
+    Context deadlineContext;
+    if(_instance->deadlinePropagation() && ref->getInvocationTimeout() != -2)
+    {
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        _deadline = getDispatchDeadline();
+        if(ref->getInvocationTimeout() > 0)
+        {
+            IceUtil::Time deadline = now + IceUtil::Time::milliSeconds(ref->getInvocationTimeout());
+            if(_deadline == IceUtil::Time() || deadline < _deadline)
+            {
+                _deadline = deadline;
+            }
+        }
+
+        if(_deadline != IceUtil::Time())
+        {
+            if(_deadline <= now)
+            {
+                throw InvocationTimeoutException(__FILE__, __LINE__);
+            }
+            ostringstream os;
+            os << (_deadline - now).toMilliSeconds();
+            deadlineContext[deadlineContextKey] = os.str();
+        }
+    }
+
     if(&context != &Ice::noExplicitContext)
     {
         //
         // Explicit context
         //
-        _os.write(context);
+        if(deadlineContext.empty())
+        {
+            _os.write(context);
+        }
+        else
+        {
+            deadlineContext.insert(context.begin(), context.end());
+            _os.write(deadlineContext);
+        }
     }
     else
     {
@@ -890,13 +1465,18 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         //
         const ImplicitContextIPtr& implicitContext = ref->getInstance()->getImplicitContext();
         const Context& prxContext = ref->getContext()->getValue();
+        if(!deadlineContext.empty())
+        {
+            deadlineContext.insert(prxContext.begin(), prxContext.end());
+        }
+        const Context& ctx = deadlineContext.empty() ? prxContext : deadlineContext;
         if(implicitContext == 0)
         {
-            _os.write(prxContext);
+            _os.write(ctx);
         }
         else
         {
-            implicitContext->write(prxContext, &_os);
+            implicitContext->write(ctx, &_os);
         }
     }
 }
@@ -1055,7 +1635,23 @@ OutgoingAsync::response()
 AsyncStatus
 OutgoingAsync::invokeRemote(const ConnectionIPtr& connection, bool compress, bool response)
 {
+    //
+    // Batch twoway requests are queued with the connection until the
+    // batch is flushed. A synchronous invocation flushes the batch, it
+    // would otherwise wait for the reply to a request which isn't sent.
+    // A request which is retried after being queued is sent right away.
+    //
     _cachedConnection = connection;
+    if(response && !_batchTwowayQueued && _proxy->__reference()->getBatchTwoway())
+    {
+        AsyncStatus status = connection->sendBatchTwowayRequest(ICE_SHARED_FROM_THIS, compress, _synchronous);
+        _batchTwowayQueued = true;
+        return status;
+    }
+    if(response && _proxy->__reference()->getEndpointSelection() == ICE_ENUM(EndpointSelectionType, Adaptive))
+    {
+        loadSent(connection);
+    }
     return connection->sendAsyncRequest(ICE_SHARED_FROM_THIS, compress, response, 0);
 }
 
@@ -1094,6 +1690,46 @@ OutgoingAsync::invoke(const string& operation)
         return; // Don't call sent/completed callback for batch AMI requests
     }
 
+    _observer.reallocated(_os.b.reallocations());
+
+    //
+    // Idempotent twoway requests are hedged if the proxy has a hedge
+    // delay. Fixed proxies are bound to their connection and can't be
+    // hedged.
+    //
+    const Reference* ref = _proxy->__reference().get();
+    if(ref->getHedgeMax() > 0 && ref->getHedgeDelay() >= 0 && mode == Reference::ModeTwoway &&
+       !ref->getBatchTwoway() &&
+       (_mode == ICE_ENUM(OperationMode, Idempotent) || _mode == ICE_ENUM(OperationMode, Nonmutating)) &&
+       dynamic_cast<const RoutableReference*>(ref))
+    {
+        //
+        // The invocation timeout applies to the hedged invocation as a
+        // whole rather than to each of its requests.
+        //
+        ObjectPrxPtr proxy = _proxy;
+        if(_deadline != IceUtil::Time())
+        {
+            _instance->timer()->schedule(ICE_SHARED_FROM_THIS,
+                                         _deadline - IceUtil::Time::now(IceUtil::Time::Monotonic));
+            proxy = _instance->proxyFactory()->referenceToProxy(ref->changeInvocationTimeout(-1));
+        }
+        else if(ref->getInvocationTimeout() > 0)
+        {
+            _instance->timer()->schedule(ICE_SHARED_FROM_THIS,
+                                         IceUtil::Time::milliSeconds(ref->getInvocationTimeout()));
+            proxy = _instance->proxyFactory()->referenceToProxy(ref->changeInvocationTimeout(-1));
+        }
+#ifdef ICE_CPP11_MAPPING
+        HedgedInvocationPtr invocation =
+            make_shared<HedgedInvocation>(static_pointer_cast<OutgoingAsync>(shared_from_this()), proxy);
+#else
+        HedgedInvocationPtr invocation = new HedgedInvocation(this, proxy);
+#endif
+        invocation->invoke();
+        return;
+    }
+
     //
     // NOTE: invokeImpl doesn't throw so this can be called from the
     // try block with the catch block calling abort() in case of an
@@ -1159,6 +1795,7 @@ ProxyFlushBatchAsync::ProxyFlushBatchAsync(const ObjectPrxPtr& proxy) : ProxyOut
 AsyncStatus
 ProxyFlushBatchAsync::invokeRemote(const ConnectionIPtr& connection, bool compress, bool)
 {
+    connection->flushBatchTwowayRequests();
     if(_batchRequestNum == 0)
     {
         if(sent())
@@ -1256,6 +1893,7 @@ ConnectionFlushBatchAsync::invoke(const string& operation)
     try
     {
         AsyncStatus status;
+        _connection->flushBatchTwowayRequests();
         int batchRequestNum = _connection->getBatchRequestQueue()->swap(&_os);
         if(batchRequestNum == 0)
         {
@@ -1392,6 +2030,7 @@ CommunicatorFlushBatchAsync::flushConnection(const ConnectionIPtr& con)
     try
     {
         OutgoingAsyncBasePtr flushBatch = ICE_MAKE_SHARED(FlushBatch, ICE_SHARED_FROM_THIS, _instance, _observer);
+        con->flushBatchTwowayRequests();
         int batchRequestNum = con->getBatchRequestQueue()->swap(flushBatch->getOs());
         if(batchRequestNum == 0)
         {
@@ -65,6 +65,13 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("Ice.Admin.MessageSizeMax", false, 0),
+    IceInternal::Property("Ice.Admin.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("Ice.Admin.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("Ice.Admin.Priority.Context", false, 0),
+    IceInternal::Property("Ice.Admin.Priority.HighCategories", false, 0),
+    IceInternal::Property("Ice.Admin.Priority.HighOperations", false, 0),
+    IceInternal::Property("Ice.Admin.Priority.LowCategories", false, 0),
+    IceInternal::Property("Ice.Admin.Priority.LowOperations", false, 0),
     IceInternal::Property("Ice.Admin.DelayCreation", false, 0),
     IceInternal::Property("Ice.Admin.Enabled", false, 0),
     IceInternal::Property("Ice.Admin.Facets", false, 0),
@@ -76,12 +83,16 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.BackgroundLocatorCacheUpdates", false, 0),
     IceInternal::Property("Ice.BatchAutoFlush", true, 0),
     IceInternal::Property("Ice.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Ice.ChangeUser", false, 0),
+    IceInternal::Property("Ice.CircuitBreaker.FailureThreshold", false, 0),
+    IceInternal::Property("Ice.CircuitBreaker.OpenTimeout", false, 0),
     IceInternal::Property("Ice.ClientAccessPolicyProtocol", false, 0),
     IceInternal::Property("Ice.Compression.Level", false, 0),
     IceInternal::Property("Ice.CollectObjects", false, 0),
     IceInternal::Property("Ice.Config", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
+    IceInternal::Property("Ice.DeadlinePropagation", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
     IceInternal::Property("Ice.Default.EndpointSelection", false, 0),
@@ -142,6 +153,11 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.PrintStackTraces", false, 0),
     IceInternal::Property("Ice.ProgramName", false, 0),
     IceInternal::Property("Ice.RetryIntervals", false, 0),
+    IceInternal::Property("Ice.RetryBackoff", false, 0),
+    IceInternal::Property("Ice.RetryBackoff.Max", false, 0),
+    IceInternal::Property("Ice.RetryBudget", false, 0),
+    IceInternal::Property("Ice.RetryBudget.MinRetries", false, 0),
+    IceInternal::Property("Ice.RequestHandlerCacheSize", false, 0),
     IceInternal::Property("Ice.ServerIdleTime", false, 0),
     IceInternal::Property("Ice.SOCKSProxyHost", false, 0),
     IceInternal::Property("Ice.SOCKSProxyPort", false, 0),
@@ -248,6 +264,13 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Priority.Context", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Priority.LowOperations", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Close", false, 0),
@@ -285,6 +308,13 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Priority.Context", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Priority.LowOperations", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Close", false, 0),
@@ -322,6 +352,13 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Priority.Context", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Priority.LowOperations", false, 0),
     IceInternal::Property("IceDiscovery.Lookup", false, 0),
     IceInternal::Property("IceDiscovery.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.RetryCount", false, 0),
@@ -375,6 +412,13 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Priority.Context", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Priority.LowOperations", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ACM.Close", false, 0),
@@ -412,6 +456,13 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Priority.Context", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Priority.LowOperations", false, 0),
     IceInternal::Property("IceGridDiscovery.Lookup", false, 0),
     IceInternal::Property("IceGridDiscovery.Timeout", false, 0),
     IceInternal::Property("IceGridDiscovery.RetryCount", false, 0),
@@ -519,6 +570,13 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Priority.Context", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Priority.LowOperations", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.Observers", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.SaveToRegistry", false, 0),
 };
@@ -566,6 +624,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Priority.Context", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Priority.LowOperations", false, 0),
     IceInternal::Property("IceGrid.InstanceName", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Heartbeat", false, 0),
@@ -604,6 +669,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Node.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Node.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceGrid.Node.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceGrid.Node.Priority.Context", false, 0),
+    IceInternal::Property("IceGrid.Node.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceGrid.Node.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceGrid.Node.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceGrid.Node.Priority.LowOperations", false, 0),
     IceInternal::Property("IceGrid.Node.AllowRunningServersAsRoot", false, 0),
     IceInternal::Property("IceGrid.Node.AllowEndpointsOverride", false, 0),
     IceInternal::Property("IceGrid.Node.CollocateRegistry", false, 0),
@@ -681,6 +753,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Priority.Context", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Priority.LowOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, 0),
@@ -728,6 +807,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Priority.Context", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Priority.LowOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.CryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.DefaultTemplates", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Timeout", false, 0),
@@ -767,6 +853,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Priority.Context", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Priority.LowOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Enabled", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Address", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Port", false, 0),
@@ -809,6 +902,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Priority.Context", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Priority.LowOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.MapSize", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.Path", false, 0),
     IceInternal::Property("IceGrid.Registry.NodeSessionTimeout", false, 0),
@@ -863,6 +963,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Priority.Context", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Priority.LowOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionFilters", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Heartbeat", false, 0),
@@ -901,6 +1008,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Priority.Context", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Priority.HighCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Priority.HighOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Priority.LowCategories", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Priority.LowOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, 0),
@@ -970,6 +1084,13 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IcePatch2.MessageSizeMax", false, 0),
+    IceInternal::Property("IcePatch2.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("IcePatch2.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("IcePatch2.Priority.Context", false, 0),
+    IceInternal::Property("IcePatch2.Priority.HighCategories", false, 0),
+    IceInternal::Property("IcePatch2.Priority.HighOperations", false, 0),
+    IceInternal::Property("IcePatch2.Priority.LowCategories", false, 0),
+    IceInternal::Property("IcePatch2.Priority.LowOperations", false, 0),
     IceInternal::Property("IcePatch2.Directory", false, 0),
     IceInternal::Property("IcePatch2.InstanceName", false, 0),
 };
@@ -1102,6 +1223,13 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("Glacier2.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Client.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("Glacier2.Client.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("Glacier2.Client.Priority.Context", false, 0),
+    IceInternal::Property("Glacier2.Client.Priority.HighCategories", false, 0),
+    IceInternal::Property("Glacier2.Client.Priority.HighOperations", false, 0),
+    IceInternal::Property("Glacier2.Client.Priority.LowCategories", false, 0),
+    IceInternal::Property("Glacier2.Client.Priority.LowOperations", false, 0),
     IceInternal::Property("Glacier2.Client.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Client.Buffered", false, 0),
     IceInternal::Property("Glacier2.Client.ForwardContext", false, 0),
@@ -1177,6 +1305,13 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("Glacier2.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Server.MaxDispatchesPerConnection", false, 0),
+    IceInternal::Property("Glacier2.Server.MaxQueuedDispatches", false, 0),
+    IceInternal::Property("Glacier2.Server.Priority.Context", false, 0),
+    IceInternal::Property("Glacier2.Server.Priority.HighCategories", false, 0),
+    IceInternal::Property("Glacier2.Server.Priority.HighOperations", false, 0),
+    IceInternal::Property("Glacier2.Server.Priority.LowCategories", false, 0),
+    IceInternal::Property("Glacier2.Server.Priority.LowOperations", false, 0),
     IceInternal::Property("Glacier2.Server.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Server.Buffered", false, 0),
     IceInternal::Property("Glacier2.Server.ForwardContext", false, 0),
@@ -23,11 +23,26 @@
 #include <Ice/LocalException.h>
 #include <Ice/ConnectionI.h> // To convert from ConnectionIPtr to ConnectionPtr in ice_getConnection().
 #include <Ice/ImplicitContextI.h>
+#include <Ice/RequestHandlerFactory.h>
+#include <Ice/CollocatedRequestHandler.h>
+#include <Ice/ObjectAdapterI.h>
+#include <Ice/ServantManager.h>
+#include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/StringUtil.h>
+#include <Ice/Protocol.h>
 
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 
+namespace IceUtilInternal
+{
+
+extern bool printStackTraces;
+
+}
+
 namespace Ice
 {
 
@@ -139,6 +154,207 @@ Ice::ObjectPrx::__checkTwowayOnly(const string& name) const
     }
 }
 
+IceInternal::DirectDispatch::DirectDispatch(ObjectPrx* proxy, const char* operation, OperationMode mode,
+                                            const Context& context) :
+    _proxy(proxy),
+    _adapter(0)
+{
+    //
+    // Only synchronous twoway invocations without invocation timeout
+    // are dispatched from the calling thread. The invocation is also
+    // sent through the request handler if it has to be dispatched by
+    // the dispatcher, observed or carry a deadline.
+    //
+    const ReferencePtr& ref = proxy->__reference();
+    const InstancePtr& instance = ref->getInstance();
+    if(ref->getMode() != Reference::ModeTwoway || !ref->getCollocationOptimized() ||
+       ref->getInvocationTimeout() > 0 || instance->initializationData().dispatcher ||
+       instance->initializationData().observer || instance->deadlinePropagation())
+    {
+        return;
+    }
+
+    ObjectAdapterIPtr adapter;
+    try
+    {
+        CollocatedRequestHandlerPtr handler =
+            ICE_DYNAMIC_CAST(CollocatedRequestHandler, proxy->__getRequestHandler());
+        if(!handler)
+        {
+            return;
+        }
+        adapter = handler->getAdapter();
+
+        //
+        // This will throw if the object adapter has been deactivated.
+        //
+        adapter->incDirectCount();
+    }
+    catch(const LocalException&)
+    {
+        return; // The request handler of the proxy reports the failure.
+    }
+
+    //
+    // Servant locators and servants which don't implement the interface
+    // of the proxy, such as dispatch interceptors, aren't supported.
+    //
+    ServantManagerPtr servantManager = adapter->getServantManager();
+    if(servantManager)
+    {
+        _servant = servantManager->findServant(ref->getIdentity(), ref->getFacet());
+    }
+    if(!_servant)
+    {
+        adapter->decDirectCount();
+        return;
+    }
+    _adapter = adapter.get();
+
+    _current.adapter = adapter;
+    _current.id = ref->getIdentity();
+    _current.facet = ref->getFacet();
+    _current.operation = operation;
+    _current.mode = mode;
+    if(&context != &noExplicitContext)
+    {
+        _current.ctx = context;
+    }
+    else
+    {
+        const ImplicitContextIPtr& implicitContext = instance->getImplicitContext();
+        if(implicitContext)
+        {
+            implicitContext->combine(ref->getContext()->getValue(), _current.ctx);
+        }
+        else
+        {
+            _current.ctx = ref->getContext()->getValue();
+        }
+    }
+    _current.requestId = -1;
+    _current.encoding = getCompatibleEncoding(ref->getEncoding());
+    _current.deadline = 0;
+}
+
+IceInternal::DirectDispatch::~DirectDispatch()
+{
+    if(_adapter)
+    {
+        _adapter->decDirectCount();
+    }
+}
+
+void
+IceInternal::DirectDispatch::handleException(const function<void(const UserException&)>& userException) const
+{
+    //
+    // Map the exception as it would be marshaled by the object adapter
+    // and unmarshaled by the proxy.
+    //
+    int warnDispatch = _proxy->__reference()->getInstance()->initializationData().properties->
+        getPropertyAsIntWithDefault("Ice.Warn.Dispatch", 1);
+    try
+    {
+        throw;
+    }
+    catch(const UserException& ex)
+    {
+        if(userException)
+        {
+            userException(ex);
+        }
+        throw UnknownUserException(__FILE__, __LINE__, ex.ice_id());
+    }
+    catch(RequestFailedException& ex)
+    {
+        if(ex.id.name.empty())
+        {
+            ex.id = _current.id;
+        }
+        if(ex.facet.empty() && !_current.facet.empty())
+        {
+            ex.facet = _current.facet;
+        }
+        if(ex.operation.empty() && !_current.operation.empty())
+        {
+            ex.operation = _current.operation;
+        }
+        if(warnDispatch > 1)
+        {
+            ostringstream str;
+            str << ex;
+            warning(str.str());
+        }
+        throw;
+    }
+    catch(const SystemException&)
+    {
+        throw;
+    }
+    catch(const UnknownException& ex)
+    {
+        if(warnDispatch > 0)
+        {
+            ostringstream str;
+            str << ex;
+            warning(str.str());
+        }
+        throw;
+    }
+    catch(const LocalException& ex)
+    {
+        ostringstream str;
+        str << ex;
+        if(warnDispatch > 0)
+        {
+            warning(str.str());
+        }
+        if(IceUtilInternal::printStackTraces)
+        {
+            str << '\n' << ex.ice_stackTrace();
+        }
+        throw UnknownLocalException(__FILE__, __LINE__, str.str());
+    }
+    catch(const Ice::Exception& ex)
+    {
+        ostringstream str;
+        str << ex;
+        if(warnDispatch > 0)
+        {
+            warning(str.str());
+        }
+        throw UnknownException(__FILE__, __LINE__, str.str());
+    }
+    catch(const std::exception& ex)
+    {
+        string msg = string("std::exception: ") + ex.what();
+        if(warnDispatch > 0)
+        {
+            warning(msg);
+        }
+        throw UnknownException(__FILE__, __LINE__, msg);
+    }
+    catch(...)
+    {
+        if(warnDispatch > 0)
+        {
+            warning("unknown c++ exception");
+        }
+        throw UnknownException(__FILE__, __LINE__, "unknown c++ exception");
+    }
+}
+
+void
+IceInternal::DirectDispatch::warning(const string& msg) const
+{
+    const InstancePtr& instance = _proxy->__reference()->getInstance();
+    Warning out(instance->initializationData().logger);
+    out << "dispatch exception: " << msg;
+    out << "\nidentity: " << identityToString(_current.id, instance->toStringMode());
+    out << "\nfacet: " << escapeString(_current.facet, "", instance->toStringMode());
+    out << "\noperation: " << _current.operation;
+}
 
 shared_ptr<ObjectPrx>
 Ice::ObjectPrx::__newInstance() const
@@ -967,10 +1183,76 @@ ICE_OBJECT_PRX::ice_invocationTimeout(Int newTimeout) const
     }
 }
 
+Int
+ICE_OBJECT_PRX::ice_getHedgeDelay() const
+{
+    return _reference->getHedgeDelay();
+}
+
+Int
+ICE_OBJECT_PRX::ice_getHedgeMax() const
+{
+    return _reference->getHedgeMax();
+}
+
+ObjectPrxPtr
+ICE_OBJECT_PRX::ice_hedge(Int delay, Int max) const
+{
+    if(delay < -1 || max < 0)
+    {
+        ostringstream s;
+        s << "invalid value passed to ice_hedge: " << delay << ", " << max;
+        throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, s.str());
+    }
+    if(delay == _reference->getHedgeDelay() && max == _reference->getHedgeMax())
+    {
+        return CONST_POINTER_CAST_OBJECT_PRX;
+    }
+    else
+    {
+        ObjectPrxPtr proxy = __newInstance();
+        proxy->setup(_reference->changeHedge(delay, max));
+        return proxy;
+    }
+}
+
+Int
+ICE_OBJECT_PRX::ice_getBatchAutoFlushSize() const
+{
+    return _reference->getBatchAutoFlushSize();
+}
+
+Int
+ICE_OBJECT_PRX::ice_getBatchAutoFlushDelay() const
+{
+    return _reference->getBatchAutoFlushDelay();
+}
+
+ObjectPrxPtr
+ICE_OBJECT_PRX::ice_batchAutoFlush(Int size, Int delay) const
+{
+    if(size < -1 || delay < -1)
+    {
+        ostringstream s;
+        s << "invalid value passed to ice_batchAutoFlush: " << size << ", " << delay;
+        throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, s.str());
+    }
+    if(size == _reference->getBatchAutoFlushSize() && delay == _reference->getBatchAutoFlushDelay())
+    {
+        return CONST_POINTER_CAST_OBJECT_PRX;
+    }
+    else
+    {
+        ObjectPrxPtr proxy = __newInstance();
+        proxy->setup(_reference->changeBatchAutoFlush(size, delay));
+        return proxy;
+    }
+}
+
 ObjectPrxPtr
 ICE_OBJECT_PRX::ice_twoway() const
 {
-    if(_reference->getMode() == Reference::ModeTwoway)
+    if(_reference->getMode() == Reference::ModeTwoway && !_reference->getBatchTwoway())
     {
         return CONST_POINTER_CAST_OBJECT_PRX;
     }
@@ -988,6 +1270,27 @@ ICE_OBJECT_PRX::ice_isTwoway() const
     return _reference->getMode() == Reference::ModeTwoway;
 }
 
+ObjectPrxPtr
+ICE_OBJECT_PRX::ice_batchTwoway() const
+{
+    if(_reference->getBatchTwoway())
+    {
+        return CONST_POINTER_CAST_OBJECT_PRX;
+    }
+    else
+    {
+        ObjectPrxPtr proxy = __newInstance();
+        proxy->setup(_reference->changeBatchTwoway(true));
+        return proxy;
+    }
+}
+
+bool
+ICE_OBJECT_PRX::ice_isBatchTwoway() const
+{
+    return _reference->getBatchTwoway();
+}
+
 ObjectPrxPtr
 ICE_OBJECT_PRX::ice_oneway() const
 {
@@ -1177,6 +1480,22 @@ ICE_OBJECT_PRX::__handleException(const Exception& ex,
 {
     __updateRequestHandler(handler, 0); // Clear the request handler
 
+    //
+    // Also remove the request handler from the factory cache so that
+    // proxies with the same connection settings don't pick it up.
+    //
+    if(handler)
+    {
+        try
+        {
+            _reference->getInstance()->requestHandlerFactory()->removeRequestHandler(_reference, handler);
+        }
+        catch(const CommunicatorDestroyedException&)
+        {
+            // Ignore
+        }
+    }
+
     //
     // We only retry local exception, system exceptions aren't retried.
     //
@@ -9,6 +9,7 @@
 
 #include <IceUtil/Thread.h>
 #include <IceUtil/Time.h>
+#include <IceUtil/Random.h>
 #include <Ice/ProxyFactory.h>
 #include <Ice/Instance.h>
 #include <Ice/Proxy.h>
@@ -239,6 +240,21 @@ IceInternal::ProxyFactory::checkRetryAfterException(const LocalException& ex, co
         }
         ex.ice_throw();
     }
+    else if(_retryBackoff > 0)
+    {
+        //
+        // Exponential backoff with full jitter: the interval is random
+        // between 0 and the backoff delay, which doubles with each retry
+        // until it reaches the maximum. The jitter prevents clients which
+        // failed together from retrying together.
+        //
+        int backoff = _retryBackoff;
+        for(int i = 1; i < cnt && backoff < _retryBackoffMax; ++i)
+        {
+            backoff = backoff > _retryBackoffMax / 2 ? _retryBackoffMax : backoff * 2;
+        }
+        interval = static_cast<int>(IceUtilInternal::random(backoff + 1));
+    }
     else
     {
         interval = _retryIntervals[cnt - 1];
@@ -258,8 +274,16 @@ IceInternal::ProxyFactory::checkRetryAfterException(const LocalException& ex, co
 }
 
 IceInternal::ProxyFactory::ProxyFactory(const InstancePtr& instance) :
-    _instance(instance)
+    _instance(instance),
+    _retryBackoff(instance->initializationData().properties->getPropertyAsInt("Ice.RetryBackoff")),
+    _retryBackoffMax(instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.RetryBackoff.Max",
+                                                                                             10000))
 {
+    if(_retryBackoffMax < _retryBackoff)
+    {
+        _retryBackoffMax = _retryBackoff;
+    }
+
     StringSeq retryValues = _instance->initializationData().properties->getPropertyAsList("Ice.RetryIntervals");
     if(retryValues.size() == 0)
     {
@@ -55,6 +55,8 @@ private:
 
     InstancePtr _instance;
     std::vector<int> _retryIntervals;
+    int _retryBackoff;
+    int _retryBackoffMax;
 };
 
 }
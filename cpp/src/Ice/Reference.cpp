@@ -92,12 +92,13 @@ IceInternal::Reference::changeContext(const Context& newContext) const
 ReferencePtr
 IceInternal::Reference::changeMode(Mode newMode) const
 {
-    if(newMode == _mode)
+    if(newMode == _mode && !_batchTwoway)
     {
         return ReferencePtr(const_cast<Reference*>(this));
     }
     ReferencePtr r = _instance->referenceFactory()->copy(this);
     r->_mode = newMode;
+    r->_batchTwoway = false;
     return r;
 }
 
@@ -149,6 +150,45 @@ IceInternal::Reference::changeInvocationTimeout(int invocationTimeout) const
     return r;
 }
 
+ReferencePtr
+IceInternal::Reference::changeBatchTwoway(bool newBatchTwoway) const
+{
+    if(newBatchTwoway == _batchTwoway && _mode == ModeTwoway)
+    {
+        return ReferencePtr(const_cast<Reference*>(this));
+    }
+    ReferencePtr r = _instance->referenceFactory()->copy(this);
+    r->_mode = ModeTwoway;
+    r->_batchTwoway = newBatchTwoway;
+    return r;
+}
+
+ReferencePtr
+IceInternal::Reference::changeHedge(int hedgeDelay, int hedgeMax) const
+{
+    if(_hedgeDelay == hedgeDelay && _hedgeMax == hedgeMax)
+    {
+        return ReferencePtr(const_cast<Reference*>(this));
+    }
+    ReferencePtr r = _instance->referenceFactory()->copy(this);
+    r->_hedgeDelay = hedgeDelay;
+    r->_hedgeMax = hedgeMax;
+    return r;
+}
+
+ReferencePtr
+IceInternal::Reference::changeBatchAutoFlush(int batchAutoFlushSize, int batchAutoFlushDelay) const
+{
+    if(_batchAutoFlushSize == batchAutoFlushSize && _batchAutoFlushDelay == batchAutoFlushDelay)
+    {
+        return ReferencePtr(const_cast<Reference*>(this));
+    }
+    ReferencePtr r = _instance->referenceFactory()->copy(this);
+    r->_batchAutoFlushSize = batchAutoFlushSize;
+    r->_batchAutoFlushDelay = batchAutoFlushDelay;
+    return r;
+}
+
 ReferencePtr
 IceInternal::Reference::changeEncoding(const Ice::EncodingVersion& encoding) const
 {
@@ -383,6 +423,21 @@ IceInternal::Reference::operator==(const Reference& r) const
     {
         return false;
     }
+
+    if(_batchTwoway != r._batchTwoway)
+    {
+        return false;
+    }
+
+    if(_hedgeDelay != r._hedgeDelay || _hedgeMax != r._hedgeMax)
+    {
+        return false;
+    }
+
+    if(_batchAutoFlushSize != r._batchAutoFlushSize || _batchAutoFlushDelay != r._batchAutoFlushDelay)
+    {
+        return false;
+    }
     return true;
 }
 
@@ -485,6 +540,51 @@ IceInternal::Reference::operator<(const Reference& r) const
         return false;
     }
 
+    if(!_batchTwoway && r._batchTwoway)
+    {
+        return true;
+    }
+    else if(r._batchTwoway < _batchTwoway)
+    {
+        return false;
+    }
+
+    if(_hedgeDelay < r._hedgeDelay)
+    {
+        return true;
+    }
+    else if(r._hedgeDelay < _hedgeDelay)
+    {
+        return false;
+    }
+
+    if(_hedgeMax < r._hedgeMax)
+    {
+        return true;
+    }
+    else if(r._hedgeMax < _hedgeMax)
+    {
+        return false;
+    }
+
+    if(_batchAutoFlushSize < r._batchAutoFlushSize)
+    {
+        return true;
+    }
+    else if(r._batchAutoFlushSize < _batchAutoFlushSize)
+    {
+        return false;
+    }
+
+    if(_batchAutoFlushDelay < r._batchAutoFlushDelay)
+    {
+        return true;
+    }
+    else if(r._batchAutoFlushDelay < _batchAutoFlushDelay)
+    {
+        return false;
+    }
+
     return false;
 }
 
@@ -531,6 +631,11 @@ IceInternal::Reference::Reference(const InstancePtr& instance,
     _protocol(protocol),
     _encoding(encoding),
     _invocationTimeout(invocationTimeout),
+    _batchTwoway(false),
+    _hedgeDelay(-1),
+    _hedgeMax(0),
+    _batchAutoFlushSize(-1),
+    _batchAutoFlushDelay(-1),
     _overrideCompress(false),
     _compress(false)
 {
@@ -548,6 +653,11 @@ IceInternal::Reference::Reference(const Reference& r) :
     _protocol(r._protocol),
     _encoding(r._encoding),
     _invocationTimeout(r._invocationTimeout),
+    _batchTwoway(r._batchTwoway),
+    _hedgeDelay(r._hedgeDelay),
+    _hedgeMax(r._hedgeMax),
+    _batchAutoFlushSize(r._batchAutoFlushSize),
+    _batchAutoFlushDelay(r._batchAutoFlushDelay),
     _overrideCompress(r._overrideCompress),
     _compress(r._compress)
 {
@@ -573,6 +683,11 @@ IceInternal::Reference::hashInit() const
     hashAdd(h, _encoding.major);
     hashAdd(h, _encoding.minor);
     hashAdd(h, _invocationTimeout);
+    hashAdd(h, _batchTwoway);
+    hashAdd(h, _hedgeDelay);
+    hashAdd(h, _hedgeMax);
+    hashAdd(h, _batchAutoFlushSize);
+    hashAdd(h, _batchAutoFlushDelay);
     return h;
 }
 
@@ -1256,7 +1371,24 @@ IceInternal::RoutableReference::toProperty(const string& prefix) const
     properties[prefix + ".CollocationOptimized"] = _collocationOptimized ? "1" : "0";
     properties[prefix + ".ConnectionCached"] = _cacheConnection ? "1" : "0";
     properties[prefix + ".PreferSecure"] = _preferSecure ? "1" : "0";
-    properties[prefix + ".EndpointSelection"] = _endpointSelection == Random ? "Random" : "Ordered";
+    switch(_endpointSelection)
+    {
+        case Random:
+        {
+            properties[prefix + ".EndpointSelection"] = "Random";
+            break;
+        }
+        case Ordered:
+        {
+            properties[prefix + ".EndpointSelection"] = "Ordered";
+            break;
+        }
+        case Adaptive:
+        {
+            properties[prefix + ".EndpointSelection"] = "Adaptive";
+            break;
+        }
+    }
     {
         ostringstream s;
         s << _locatorCacheTimeout;
@@ -1517,6 +1649,167 @@ IceInternal::RoutableReference::getBatchRequestQueue() const
     return new BatchRequestQueue(getInstance(), getMode() == Reference::ModeBatchDatagram);
 }
 
+bool
+IceInternal::RoutableReference::connectionLess(const RoutableReference& rhs) const
+{
+    if(this == &rhs)
+    {
+        return false;
+    }
+
+    if(getMode() < rhs.getMode())
+    {
+        return true;
+    }
+    else if(rhs.getMode() < getMode())
+    {
+        return false;
+    }
+    if(!getSecure() && rhs.getSecure())
+    {
+        return true;
+    }
+    else if(rhs.getSecure() < getSecure())
+    {
+        return false;
+    }
+    if(getProtocol() < rhs.getProtocol())
+    {
+        return true;
+    }
+    else if(rhs.getProtocol() < getProtocol())
+    {
+        return false;
+    }
+    if(!_overrideCompress && rhs._overrideCompress)
+    {
+        return true;
+    }
+    else if(rhs._overrideCompress < _overrideCompress)
+    {
+        return false;
+    }
+    else if(_overrideCompress)
+    {
+        if(!_compress && rhs._compress)
+        {
+            return true;
+        }
+        else if(rhs._compress < _compress)
+        {
+            return false;
+        }
+    }
+    if(!_preferSecure && rhs._preferSecure)
+    {
+        return true;
+    }
+    else if(rhs._preferSecure < _preferSecure)
+    {
+        return false;
+    }
+    if(_endpointSelection < rhs._endpointSelection)
+    {
+        return true;
+    }
+    else if(rhs._endpointSelection < _endpointSelection)
+    {
+        return false;
+    }
+    if(_connectionId < rhs._connectionId)
+    {
+        return true;
+    }
+    else if(rhs._connectionId < _connectionId)
+    {
+        return false;
+    }
+    if(!_overrideTimeout && rhs._overrideTimeout)
+    {
+        return true;
+    }
+    else if(rhs._overrideTimeout < _overrideTimeout)
+    {
+        return false;
+    }
+    else if(_overrideTimeout)
+    {
+        if(_timeout < rhs._timeout)
+        {
+            return true;
+        }
+        else if(rhs._timeout < _timeout)
+        {
+            return false;
+        }
+    }
+    if(_routerInfo < rhs._routerInfo)
+    {
+        return true;
+    }
+    else if(rhs._routerInfo < _routerInfo)
+    {
+        return false;
+    }
+    if(_locatorInfo < rhs._locatorInfo)
+    {
+        return true;
+    }
+    else if(rhs._locatorInfo < _locatorInfo)
+    {
+        return false;
+    }
+    if(_adapterId < rhs._adapterId)
+    {
+        return true;
+    }
+    else if(rhs._adapterId < _adapterId)
+    {
+        return false;
+    }
+#ifdef ICE_CPP11_MAPPING
+    Ice::TargetCompare<shared_ptr<EndpointI>, std::less> endpointLess;
+    if(lexicographical_compare(_endpoints.begin(), _endpoints.end(), rhs._endpoints.begin(), rhs._endpoints.end(),
+                               endpointLess))
+    {
+        return true;
+    }
+    else if(lexicographical_compare(rhs._endpoints.begin(), rhs._endpoints.end(), _endpoints.begin(), _endpoints.end(),
+                                    endpointLess))
+    {
+        return false;
+    }
+#else
+    if(_endpoints < rhs._endpoints)
+    {
+        return true;
+    }
+    else if(rhs._endpoints < _endpoints)
+    {
+        return false;
+    }
+#endif
+    if(_locatorCacheTimeout < rhs._locatorCacheTimeout)
+    {
+        return true;
+    }
+    else if(rhs._locatorCacheTimeout < _locatorCacheTimeout)
+    {
+        return false;
+    }
+
+    //
+    // Well-known references are resolved with their identity and the
+    // router must be told about each routed proxy, so the connection of
+    // these references can't be shared by proxies for other objects.
+    //
+    if(_routerInfo || isWellKnown())
+    {
+        return getIdentity() < rhs.getIdentity();
+    }
+    return false;
+}
+
 void
 IceInternal::RoutableReference::getConnection(const GetConnectionCallbackPtr& callback) const
 {
@@ -1921,6 +2214,17 @@ IceInternal::RoutableReference::filterEndpoints(const vector<EndpointIPtr>& allE
             // Nothing to do.
             break;
         }
+        case Adaptive:
+        {
+            //
+            // The endpoints are shuffled first so that endpoints with
+            // the same load are used evenly.
+            //
+            RandomNumberGenerator rng;
+            random_shuffle(endpoints.begin(), endpoints.end(), rng);
+            getInstance()->outgoingConnectionFactory()->sortByLoad(endpoints);
+            break;
+        }
         default:
         {
             assert(false);
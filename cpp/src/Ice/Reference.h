@@ -72,6 +72,11 @@ public:
     const InstancePtr& getInstance() const { return _instance; }
     const SharedContextPtr& getContext() const { return _context; }
     int getInvocationTimeout() const { return _invocationTimeout; }
+    bool getBatchTwoway() const { return _batchTwoway; }
+    int getHedgeDelay() const { return _hedgeDelay; }
+    int getHedgeMax() const { return _hedgeMax; }
+    int getBatchAutoFlushSize() const { return _batchAutoFlushSize; }
+    int getBatchAutoFlushDelay() const { return _batchAutoFlushDelay; }
 
     Ice::CommunicatorPtr getCommunicator() const;
 
@@ -98,6 +103,9 @@ public:
     ReferencePtr changeIdentity(const Ice::Identity&) const;
     ReferencePtr changeFacet(const std::string&) const;
     ReferencePtr changeInvocationTimeout(int) const;
+    ReferencePtr changeBatchTwoway(bool) const;
+    ReferencePtr changeHedge(int, int) const;
+    ReferencePtr changeBatchAutoFlush(int, int) const;
     virtual ReferencePtr changeEncoding(const Ice::EncodingVersion&) const;
     virtual ReferencePtr changeCompress(bool) const;
 
@@ -172,6 +180,11 @@ private:
     Ice::ProtocolVersion _protocol;
     Ice::EncodingVersion _encoding;
     int _invocationTimeout;
+    bool _batchTwoway; // Twoway requests are queued by the connection until flushed.
+    int _hedgeDelay; // Delay before idempotent requests are hedged, -1 if hedging is disabled.
+    int _hedgeMax; // Maximum number of hedged requests sent in addition to the first one.
+    int _batchAutoFlushSize; // Batch auto-flush size in kilobytes, -1 for the communicator setting.
+    int _batchAutoFlushDelay; // Batch auto-flush delay in milliseconds, -1 for the communicator setting.
 
 protected:
 
@@ -280,6 +293,14 @@ public:
     virtual RequestHandlerPtr getRequestHandler(const Ice::ObjectPrxPtr&) const;
     virtual BatchRequestQueuePtr getBatchRequestQueue() const;
 
+    //
+    // Orders references by the settings which determine the connection
+    // used to send requests. Settings such as the facet, the context or
+    // the invocation timeout are ignored; the identity is only compared
+    // for well-known and routed references.
+    //
+    bool connectionLess(const RoutableReference&) const;
+
     void getConnection(const GetConnectionCallbackPtr&) const;
     void getConnectionNoRouterInfo(const GetConnectionCallbackPtr&) const;
 
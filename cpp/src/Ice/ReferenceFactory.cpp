@@ -863,10 +863,14 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
             {
                 endpointSelection = Ordered;
             }
+            else if(type == "Adaptive")
+            {
+                endpointSelection = Adaptive;
+            }
             else
             {
                 EndpointSelectionTypeParseException ex(__FILE__, __LINE__);
-                ex.str = "illegal value `" + type + "'; expected `Random' or `Ordered'";
+                ex.str = "illegal value `" + type + "'; expected `Random', `Ordered' or `Adaptive'";
                 throw ex;
             }
         }
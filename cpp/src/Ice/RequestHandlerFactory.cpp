@@ -14,11 +14,35 @@
 #include <Ice/Reference.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Instance.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/Properties.h>
 
 using namespace std;
 using namespace IceInternal;
 
-RequestHandlerFactory::RequestHandlerFactory(const InstancePtr& instance) : _instance(instance)
+namespace
+{
+
+size_t
+getCacheSize(const InstancePtr& instance)
+{
+    int size = instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.RequestHandlerCacheSize",
+                                                                                        100);
+    return size > 0 ? static_cast<size_t>(size) : 0;
+}
+
+}
+
+bool
+RequestHandlerFactory::ConnectionCompare::operator()(const RoutableReferencePtr& lhs,
+                                                     const RoutableReferencePtr& rhs) const
+{
+    return lhs->connectionLess(*rhs);
+}
+
+RequestHandlerFactory::RequestHandlerFactory(const InstancePtr& instance) :
+    _instance(instance),
+    _cacheSize(getCacheSize(instance))
 {
 }
 
@@ -34,6 +58,34 @@ IceInternal::RequestHandlerFactory::getRequestHandler(const RoutableReferencePtr
         }
     }
 
+    if(ref->getCacheConnection() && _cacheSize > 0)
+    {
+        //
+        // If another proxy with the same connection settings already
+        // established its connection, share its request handler. The
+        // connection state is checked without the mutex locked, this
+        // factory can be called with a connection locked.
+        //
+        RequestHandlerPtr cached;
+        {
+            Lock sync(*this);
+            CachedHandlerMap::iterator q = _cachedHandlers.find(ref);
+            if(q != _cachedHandlers.end())
+            {
+                _cachedHandlersUsage.splice(_cachedHandlersUsage.begin(), _cachedHandlersUsage, q->second.position);
+                cached = q->second.handler;
+            }
+        }
+        if(cached)
+        {
+            if(cached->getConnection()->isActiveOrHolding())
+            {
+                return proxy->__setRequestHandler(cached);
+            }
+            removeRequestHandler(ref, cached);
+        }
+    }
+
     ConnectRequestHandlerPtr handler;
     bool connect = false;
     if(ref->getCacheConnection())
@@ -67,6 +119,46 @@ IceInternal::RequestHandlerFactory::getRequestHandler(const RoutableReferencePtr
     return proxy->__setRequestHandler(handler->connect(proxy));
 }
 
+void
+IceInternal::RequestHandlerFactory::addRequestHandler(const ReferencePtr& ref, const RequestHandlerPtr& handler)
+{
+    RoutableReferencePtr routableRef = RoutableReferencePtr::dynamicCast(ref);
+    if(!routableRef || !routableRef->getCacheConnection() || _cacheSize == 0)
+    {
+        return;
+    }
+
+    //
+    // Indirect references aren't shared, new proxies must get their
+    // endpoints from the locator cache which might have been updated
+    // since the connection was established.
+    //
+    if(routableRef->isIndirect())
+    {
+        return;
+    }
+
+    Lock sync(*this);
+    CachedHandlerMap::iterator p = _cachedHandlers.find(routableRef);
+    if(p != _cachedHandlers.end())
+    {
+        p->second.handler = handler;
+        _cachedHandlersUsage.splice(_cachedHandlersUsage.begin(), _cachedHandlersUsage, p->second.position);
+        return;
+    }
+
+    if(_cachedHandlers.size() == _cacheSize)
+    {
+        removeCachedHandler(_cachedHandlers.find(_cachedHandlersUsage.back()));
+    }
+
+    _cachedHandlersUsage.push_front(routableRef);
+    CachedHandler cached;
+    cached.handler = handler;
+    cached.position = _cachedHandlersUsage.begin();
+    _cachedHandlers.insert(make_pair(routableRef, cached));
+}
+
 void
 IceInternal::RequestHandlerFactory::removeRequestHandler(const ReferencePtr& ref, const RequestHandlerPtr& handler)
 {
@@ -78,5 +170,24 @@ IceInternal::RequestHandlerFactory::removeRequestHandler(const ReferencePtr& ref
         {
             _handlers.erase(p);
         }
+
+        RoutableReferencePtr routableRef = RoutableReferencePtr::dynamicCast(ref);
+        if(routableRef)
+        {
+            CachedHandlerMap::iterator q = _cachedHandlers.find(routableRef);
+            if(q != _cachedHandlers.end() && q->second.handler.get() == handler.get())
+            {
+                removeCachedHandler(q);
+            }
+        }
     }
 }
+
+void
+IceInternal::RequestHandlerFactory::removeCachedHandler(CachedHandlerMap::iterator p)
+{
+    // Must be called with the mutex locked.
+    assert(p != _cachedHandlers.end());
+    _cachedHandlersUsage.erase(p->second.position);
+    _cachedHandlers.erase(p);
+}
@@ -19,6 +19,8 @@
 #include <Ice/ReferenceF.h>
 #include <Ice/InstanceF.h>
 
+#include <list>
+
 namespace IceInternal
 {
 
@@ -29,12 +31,37 @@ public:
     RequestHandlerFactory(const InstancePtr&);
 
     RequestHandlerPtr getRequestHandler(const RoutableReferencePtr&, const Ice::ObjectPrxPtr&);
+    void addRequestHandler(const ReferencePtr&, const RequestHandlerPtr&);
     void removeRequestHandler(const ReferencePtr&, const RequestHandlerPtr&);
 
 private:
 
+    struct ConnectionCompare
+    {
+        bool operator()(const RoutableReferencePtr&, const RoutableReferencePtr&) const;
+    };
+
+    struct CachedHandler
+    {
+        RequestHandlerPtr handler;
+        std::list<RoutableReferencePtr>::iterator position;
+    };
+    typedef std::map<RoutableReferencePtr, CachedHandler, ConnectionCompare> CachedHandlerMap;
+
+    void removeCachedHandler(CachedHandlerMap::iterator);
+
     const InstancePtr _instance;
     std::map<ReferencePtr, ConnectRequestHandlerPtr> _handlers;
+
+    //
+    // The request handlers of established connections, shared by all the
+    // proxies whose references only differ by settings which don't affect
+    // the connection. The list keeps the references in least recently used
+    // order so that the cache doesn't grow beyond _cacheSize entries.
+    //
+    const size_t _cacheSize;
+    CachedHandlerMap _cachedHandlers;
+    std::list<RoutableReferencePtr> _cachedHandlersUsage;
 };
 
 }
@@ -14,11 +14,14 @@
 #include <Ice/TraceLevels.h>
 #include <Ice/LoggerUtil.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 
 IceUtil::Shared* IceInternal::upCast(RetryQueue* p) { return p; }
+IceUtil::Shared* IceInternal::upCast(RetryBudget* p) { return p; }
 
 IceInternal::RetryTask::RetryTask(const InstancePtr& instance,
                                   const RetryQueuePtr& queue,
@@ -157,3 +160,69 @@ IceInternal::RetryQueue::cancel(const RetryTaskPtr& task)
     }
     return false;
 }
+
+IceInternal::RetryBudget::RetryBudget(int percent, int minRetries) :
+    _percent(percent),
+    _minRetries(minRetries > 0 ? minRetries : 0),
+    _invocationCount(0),
+    _retryCount(0),
+    _slot(0),
+    _slotStart(IceUtil::Time::now(IceUtil::Time::Monotonic))
+{
+    fill(_invocations, _invocations + WindowSize, 0);
+    fill(_retries, _retries + WindowSize, 0);
+}
+
+void
+IceInternal::RetryBudget::invoked()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    advance(IceUtil::Time::now(IceUtil::Time::Monotonic));
+    ++_invocations[_slot];
+    ++_invocationCount;
+}
+
+bool
+IceInternal::RetryBudget::retry()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    advance(IceUtil::Time::now(IceUtil::Time::Monotonic));
+    if(_retryCount >= _minRetries + _invocationCount * _percent / 100)
+    {
+        return false;
+    }
+    ++_retries[_slot];
+    ++_retryCount;
+    return true;
+}
+
+void
+IceInternal::RetryBudget::advance(const IceUtil::Time& now)
+{
+    // Must be called with the mutex locked.
+    IceUtil::Int64 elapsed = (now - _slotStart).toSeconds();
+    if(elapsed <= 0)
+    {
+        return;
+    }
+
+    if(elapsed >= WindowSize)
+    {
+        fill(_invocations, _invocations + WindowSize, 0);
+        fill(_retries, _retries + WindowSize, 0);
+        _invocationCount = 0;
+        _retryCount = 0;
+    }
+    else
+    {
+        for(IceUtil::Int64 i = 0; i < elapsed; ++i)
+        {
+            _slot = (_slot + 1) % WindowSize;
+            _invocationCount -= _invocations[_slot];
+            _retryCount -= _retries[_slot];
+            _invocations[_slot] = 0;
+            _retries[_slot] = 0;
+        }
+    }
+    _slotStart += IceUtil::Time::seconds(elapsed);
+}
@@ -17,6 +17,7 @@
 #include <Ice/OutgoingAsyncF.h>
 #include <Ice/InstanceF.h>
 #include <Ice/RequestHandler.h> // For CancellationHandler
+#include <Ice/Config.h>
 
 namespace IceInternal
 {
@@ -67,6 +68,41 @@ private:
     std::set<RetryTaskPtr> _requests;
 };
 
+//
+// The retry budget limits the retries of a communicator to a
+// percentage of the invocations of the last seconds, plus a minimum
+// number of retries always allowed, to prevent clients from
+// overloading servers with retries when they are recovering.
+//
+class RetryBudget : public IceUtil::Shared, public IceUtil::Mutex
+{
+public:
+
+    RetryBudget(int, int);
+
+    void invoked();
+    bool retry();
+
+private:
+
+    void advance(const IceUtil::Time&);
+
+    const int _percent;
+    const int _minRetries;
+
+    //
+    // The invocations and retries are counted over a sliding window
+    // of slots, each covering one second.
+    //
+    enum { WindowSize = 10 };
+    Ice::Int _invocations[WindowSize];
+    Ice::Int _retries[WindowSize];
+    Ice::Long _invocationCount;
+    Ice::Long _retryCount;
+    size_t _slot;
+    IceUtil::Time _slotStart;
+};
+
 }
 
 #endif
@@ -13,6 +13,7 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/Instance.h>
 #include <Ice/StringUtil.h>
+#include <Ice/HashUtil.h>
 
 using namespace std;
 using namespace Ice;
@@ -27,16 +28,19 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    ServantMapShard& shard = getServantMapShard(ident);
+    IceUtil::Mutex::Lock shardSync(shard);
 
-    if(p == _servantMapMap.end() || p->first != ident)
+    ServantMapMap::iterator p = shard.servantMapMapHint;
+
+    if(p == shard.servantMapMap.end() || p->first != ident)
     {
-        p = _servantMapMap.find(ident);
+        p = shard.servantMapMap.find(ident);
     }
 
-    if(p == _servantMapMap.end())
+    if(p == shard.servantMapMap.end())
     {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
+        p = shard.servantMapMap.insert(shard.servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
     }
     else
     {
@@ -54,7 +58,7 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
         }
     }
 
-    _servantMapMapHint = p;
+    shard.servantMapMapHint = p;
 
     p->second.insert(pair<const string, ObjectPtr>(facet, object));
 }
@@ -92,15 +96,18 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    ServantMapShard& shard = getServantMapShard(ident);
+    IceUtil::Mutex::Lock shardSync(shard);
+
+    ServantMapMap::iterator p = shard.servantMapMapHint;
     FacetMap::iterator q;
 
-    if(p == _servantMapMap.end() || p->first != ident)
+    if(p == shard.servantMapMap.end() || p->first != ident)
     {
-        p = _servantMapMap.find(ident);
+        p = shard.servantMapMap.find(ident);
     }
 
-    if(p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if(p == shard.servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant";
@@ -118,14 +125,14 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     if(p->second.empty())
     {
-        if(p == _servantMapMapHint)
+        if(p == shard.servantMapMapHint)
         {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
+            shard.servantMapMap.erase(p++);
+            shard.servantMapMapHint = p;
         }
         else
         {
-            _servantMapMap.erase(p);
+            shard.servantMapMap.erase(p);
         }
     }
     return servant;
@@ -167,14 +174,17 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    ServantMapShard& shard = getServantMapShard(ident);
+    IceUtil::Mutex::Lock shardSync(shard);
+
+    ServantMapMap::iterator p = shard.servantMapMapHint;
 
-    if(p == _servantMapMap.end() || p->first != ident)
+    if(p == shard.servantMapMap.end() || p->first != ident)
     {
-        p = _servantMapMap.find(ident);
+        p = shard.servantMapMap.find(ident);
     }
 
-    if(p == _servantMapMap.end())
+    if(p == shard.servantMapMap.end())
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant";
@@ -184,14 +194,14 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 
     FacetMap result = p->second;
 
-    if(p == _servantMapMapHint)
+    if(p == shard.servantMapMapHint)
     {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
+        shard.servantMapMap.erase(p++);
+        shard.servantMapMapHint = p;
     }
     else
     {
-        _servantMapMap.erase(p);
+        shard.servantMapMap.erase(p);
     }
 
     return result;
@@ -200,8 +210,6 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 ObjectPtr
 IceInternal::ServantManager::findServant(const Identity& ident, const string& facet) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
     //
     // This assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
@@ -210,30 +218,38 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     //
     //assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
+    {
+        //
+        // Only the shard of the servant is locked to find it, the
+        // servant manager mutex is only locked to find a default
+        // servant.
+        //
+        ServantMapShard& shard = getServantMapShard(ident);
+        IceUtil::Mutex::Lock shardSync(shard);
 
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+        ServantMapMap::iterator p = shard.servantMapMapHint;
+        FacetMap::iterator q;
 
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
+        if(p == shard.servantMapMap.end() || p->first != ident)
+        {
+            p = shard.servantMapMap.find(ident);
+        }
+
+        if(p != shard.servantMapMap.end() && (q = p->second.find(facet)) != p->second.end())
+        {
+            shard.servantMapMapHint = p;
+            return q->second;
+        }
     }
 
-    if(p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    IceUtil::Mutex::Lock sync(*this);
+    DefaultServantMap::const_iterator p = _defaultServantMap.find(ident.category);
+    if(p == _defaultServantMap.end())
     {
-        DefaultServantMap::const_iterator p = _defaultServantMap.find(ident.category);
+        p = _defaultServantMap.find("");
         if(p == _defaultServantMap.end())
         {
-            p = _defaultServantMap.find("");
-            if(p == _defaultServantMap.end())
-            {
-                return 0;
-            }
-            else
-            {
-                return p->second;
-            }
+            return 0;
         }
         else
         {
@@ -242,8 +258,7 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     }
     else
     {
-        _servantMapMapHint = p;
-        return q->second;
+        return p->second;
     }
 }
 
@@ -270,22 +285,23 @@ IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    ServantMapShard& shard = getServantMapShard(ident);
+    IceUtil::Mutex::Lock shardSync(shard);
 
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    ServantMapMap::iterator p = shard.servantMapMapHint;
 
-    if(p == servantMapMap.end() || p->first != ident)
+    if(p == shard.servantMapMap.end() || p->first != ident)
     {
-        p = servantMapMap.find(ident);
+        p = shard.servantMapMap.find(ident);
     }
 
-    if(p == servantMapMap.end())
+    if(p == shard.servantMapMap.end())
     {
         return FacetMap();
     }
     else
     {
-        _servantMapMapHint = p;
+        shard.servantMapMapHint = p;
         return p->second;
     }
 }
@@ -293,8 +309,6 @@ IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 bool
 IceInternal::ServantManager::hasServant(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
     //
     // This assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
@@ -303,21 +317,23 @@ IceInternal::ServantManager::hasServant(const Identity& ident) const
     //
     //assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    ServantMapShard& shard = getServantMapShard(ident);
+    IceUtil::Mutex::Lock shardSync(shard);
 
-    if(p == servantMapMap.end() || p->first != ident)
+    ServantMapMap::iterator p = shard.servantMapMapHint;
+
+    if(p == shard.servantMapMap.end() || p->first != ident)
     {
-        p = servantMapMap.find(ident);
+        p = shard.servantMapMap.find(ident);
     }
 
-    if(p == servantMapMap.end())
+    if(p == shard.servantMapMap.end())
     {
         return false;
     }
     else
     {
-        _servantMapMapHint = p;
+        shard.servantMapMapHint = p;
         assert(!p->second.empty());
         return true;
     }
@@ -421,9 +437,12 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
 IceInternal::ServantManager::ServantManager(const InstancePtr& instance, const string& adapterName)
     : _instance(instance),
       _adapterName(adapterName),
-      _servantMapMapHint(_servantMapMap.end()),
       _locatorMapHint(_locatorMap.end())
 {
+    for(int i = 0; i < servantMapShards; ++i)
+    {
+        _servantMapShards[i].servantMapMapHint = _servantMapShards[i].servantMapMap.end();
+    }
 }
 
 IceInternal::ServantManager::~ServantManager()
@@ -439,7 +458,7 @@ IceInternal::ServantManager::~ServantManager()
 void
 IceInternal::ServantManager::destroy()
 {
-    ServantMapMap servantMapMap;
+    ServantMapMap servantMapMaps[servantMapShards];
     DefaultServantMap defaultServantMap;
     map<string, ServantLocatorPtr> locatorMap;
     Ice::LoggerPtr logger;
@@ -456,8 +475,12 @@ IceInternal::ServantManager::destroy()
 
         logger = _instance->initializationData().logger;
 
-        servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
+        for(int i = 0; i < servantMapShards; ++i)
+        {
+            IceUtil::Mutex::Lock shardSync(_servantMapShards[i]);
+            servantMapMaps[i].swap(_servantMapShards[i].servantMapMap);
+            _servantMapShards[i].servantMapMapHint = _servantMapShards[i].servantMapMap.end();
+        }
 
         defaultServantMap.swap(_defaultServantMap);
 
@@ -495,7 +518,25 @@ IceInternal::ServantManager::destroy()
     // hold any internal Ice mutex while running user code (such as servant
     // or servant locator destructors).
     //
-    servantMapMap.clear();
+    for(int i = 0; i < servantMapShards; ++i)
+    {
+        servantMapMaps[i].clear();
+    }
     locatorMap.clear();
     defaultServantMap.clear();
 }
+
+IceInternal::ServantManager::ServantMapShard&
+IceInternal::ServantManager::getServantMapShard(const Identity& ident) const
+{
+    Int h = 5381;
+    hashAdd(h, ident.name);
+    hashAdd(h, ident.category);
+
+    //
+    // Multiplicative hashing, the shard is selected with the upper bits
+    // of the product which depend on all the bits of the hash.
+    //
+    unsigned int shard = ((static_cast<unsigned int>(h) * 2654435761u) >> 16) & (servantMapShards - 1);
+    return _servantMapShards[shard];
+}
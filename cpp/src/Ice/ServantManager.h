@@ -60,8 +60,22 @@ private:
     typedef std::map<Ice::Identity, Ice::FacetMap> ServantMapMap;
     typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
 
-    ServantMapMap _servantMapMap;
-    mutable ServantMapMap::iterator _servantMapMapHint;
+    //
+    // The servants are split in shards selected with the hash of their
+    // identity. Each shard has its own mutex and lookup hint so that
+    // concurrent dispatches to different servants rarely contend. The
+    // shard mutexes are locked after the servant manager mutex.
+    //
+    struct ServantMapShard : public IceUtil::Mutex
+    {
+        ServantMapMap servantMapMap;
+        ServantMapMap::iterator servantMapMapHint;
+    };
+
+    static const int servantMapShards = 32; // Must be a power of 2.
+    ServantMapShard& getServantMapShard(const Ice::Identity&) const;
+
+    mutable ServantMapShard _servantMapShards[servantMapShards];
 
     DefaultServantMap _defaultServantMap;
 
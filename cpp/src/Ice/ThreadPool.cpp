@@ -144,7 +144,8 @@ IceInternal::DispatchWorkItem::execute(ThreadPoolCurrent& current)
 
 IceInternal::ThreadPoolWorkQueue::ThreadPoolWorkQueue(ThreadPool& threadPool) :
     _threadPool(threadPool),
-    _destroyed(false)
+    _destroyed(false),
+    _size(0)
 {
     _registered = SocketOperationRead;
 }
@@ -163,14 +164,15 @@ IceInternal::ThreadPoolWorkQueue::destroy()
 }
 
 void
-IceInternal::ThreadPoolWorkQueue::queue(const ThreadPoolWorkItemPtr& item)
+IceInternal::ThreadPoolWorkQueue::queue(const ThreadPoolWorkItemPtr& item, DispatchPriority priority)
 {
     //Lock sync(*this); Called with the thread pool locked
-    _workItems.push_back(item);
+    _workItems[priority].push_back(item);
+    ++_size;
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
     _threadPool._selector.completed(this, SocketOperationRead);
 #else
-    if(_workItems.size() == 1)
+    if(_size == 1)
     {
         _threadPool._selector.ready(this, SocketOperationRead, true);
     }
@@ -199,10 +201,16 @@ IceInternal::ThreadPoolWorkQueue::message(ThreadPoolCurrent& current)
     ThreadPoolWorkItemPtr workItem;
     {
         IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_threadPool);
-        if(!_workItems.empty())
+        if(_size > 0)
         {
-            workItem = _workItems.front();
-            _workItems.pop_front();
+            list<ThreadPoolWorkItemPtr>* workItems = _workItems;
+            while(workItems->empty())
+            {
+                ++workItems;
+            }
+            workItem = workItems->front();
+            workItems->pop_front();
+            --_size;
         }
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
         else
@@ -211,7 +219,7 @@ IceInternal::ThreadPoolWorkQueue::message(ThreadPoolCurrent& current)
             _threadPool._selector.completed(this, SocketOperationRead);
         }
 #else
-        if(_workItems.empty() && !_destroyed)
+        if(_size == 0 && !_destroyed)
         {
             _threadPool._selector.ready(this, SocketOperationRead, false);
         }
@@ -563,14 +571,14 @@ IceInternal::ThreadPool::dispatchFromThisThread(const DispatchWorkItemPtr& workI
 }
 
 void
-IceInternal::ThreadPool::dispatch(const DispatchWorkItemPtr& workItem)
+IceInternal::ThreadPool::dispatch(const DispatchWorkItemPtr& workItem, DispatchPriority priority)
 {
     Lock sync(*this);
     if(_destroyed)
     {
         throw CommunicatorDestroyedException(__FILE__, __LINE__);
     }
-    _workQueue->queue(workItem);
+    _workQueue->queue(workItem, priority);
 }
 
 void
@@ -37,6 +37,18 @@ class ThreadPoolCurrent;
 class ThreadPoolWorkQueue;
 ICE_DEFINE_PTR(ThreadPoolWorkQueuePtr, ThreadPoolWorkQueue);
 
+//
+// The priority classes of the work items queued with the thread pool.
+// Work items are executed in priority order and in FIFO order within
+// a class. Work items queued by the Ice run time use the normal class.
+//
+enum DispatchPriority
+{
+    DispatchPriorityHigh,
+    DispatchPriorityNormal,
+    DispatchPriorityLow
+};
+
 class ThreadPoolWorkItem : public virtual IceUtil::Shared
 {
 public:
@@ -109,12 +121,17 @@ public:
     void ready(const EventHandlerPtr&, SocketOperation, bool);
 
     void dispatchFromThisThread(const DispatchWorkItemPtr&);
-    void dispatch(const DispatchWorkItemPtr&);
+    void dispatch(const DispatchWorkItemPtr&, DispatchPriority = DispatchPriorityNormal);
 
     void joinWithAllThreads();
 
     std::string prefix() const;
 
+    bool serialize() const
+    {
+        return _serialize;
+    }
+
 private:
 
     void run(const EventHandlerThreadPtr&);
@@ -227,7 +244,7 @@ public:
     ThreadPoolWorkQueue(ThreadPool&);
 
     void destroy();
-    void queue(const ThreadPoolWorkItemPtr&);
+    void queue(const ThreadPoolWorkItemPtr&, DispatchPriority = DispatchPriorityNormal);
 
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
     bool startAsync(SocketOperation);
@@ -243,7 +260,8 @@ private:
 
     ThreadPool& _threadPool;
     bool _destroyed;
-    std::list<ThreadPoolWorkItemPtr> _workItems;
+    std::list<ThreadPoolWorkItemPtr> _workItems[DispatchPriorityLow + 1];
+    size_t _size;
 };
 
 //
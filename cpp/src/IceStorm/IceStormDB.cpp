@@ -9,6 +9,7 @@
 
 #include <IceUtil/Options.h>
 #include <IceUtil/FileUtil.h>
+#include <IceUtil/StringUtil.h>
 #include <Ice/Ice.h>
 #include <IceDB/IceDB.h>
 #include <IceStorm/DBTypes.h>
@@ -159,36 +160,28 @@ Client::run(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
 
-            ifstream fs(IceUtilInternal::streamFilename(dbFile).c_str(), ios::binary);
-            if(fs.fail())
+            IceUtilInternal::MappedFilePtr file;
+            try
             {
-                cerr << argv[0] << ": could not open input file: " << strerror(errno) << endl;
+                file = new IceUtilInternal::MappedFile(dbFile);
+            }
+            catch(const IceUtil::SyscallException& ex)
+            {
+                cerr << argv[0] << ": could not open input file: " << IceUtilInternal::errorToString(ex.error())
+                     << endl;
                 return EXIT_FAILURE;
             }
-            fs.unsetf(ios::skipws);
 
-            fs.seekg(0, ios::end);
-            streampos fileSize = fs.tellg();
-
-            if(!fileSize)
+            if(file->size() == 0)
             {
-                fs.close();
                 cerr << argv[0] << ": empty input file" << endl;
                 return EXIT_FAILURE;
             }
 
-            fs.seekg(0, ios::beg);
-
-            vector<Ice::Byte> buf;
-            buf.reserve(static_cast<size_t>(fileSize));
-            buf.insert(buf.begin(), istream_iterator<Ice::Byte>(fs), istream_iterator<Ice::Byte>());
-
-            fs.close();
-
             string type;
             int version;
 
-            Ice::InputStream stream(communicator(), dbContext.encoding, buf);
+            Ice::InputStream stream(communicator(), dbContext.encoding, file);
             stream.read(type);
             if(type != "IceStorm")
             {
@@ -297,19 +290,27 @@ Client::run(int argc, char* argv[])
                 env.close();
             }
 
-            Ice::OutputStream stream(communicator(), dbContext.encoding);
-            stream.write("IceStorm");
-            stream.write(ICE_INT_VERSION);
-            stream.write(data);
-
-            ofstream fs(IceUtilInternal::streamFilename(dbFile).c_str(), ios::binary);
-            if(fs.fail())
+            //
+            // Marshal the data directly into the mapped output file, the
+            // stream falls back to the heap if the estimate is too small.
+            //
+            IceUtilInternal::MappedFilePtr file;
+            try
+            {
+                file = new IceUtilInternal::MappedFile(dbFile, Ice::wireSizeEstimate(data) + 64);
+            }
+            catch(const IceUtil::SyscallException& ex)
             {
-                cerr << argv[0] << ": could not open output file: " << strerror(errno) << endl;
+                cerr << argv[0] << ": could not open output file: " << IceUtilInternal::errorToString(ex.error())
+                     << endl;
                 return EXIT_FAILURE;
             }
-            fs.write(reinterpret_cast<const char*>(stream.b.begin()), stream.b.size());
-            fs.close();
+
+            Ice::OutputStream stream(communicator(), dbContext.encoding, make_pair(file->begin(), file->end()));
+            stream.write("IceStorm");
+            stream.write(ICE_INT_VERSION);
+            stream.write(data);
+            file->finish(stream.finished());
         }
     }
     catch(const IceUtil::Exception& ex)
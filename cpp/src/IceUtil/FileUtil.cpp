@@ -23,6 +23,7 @@
 #else
 #  include <unistd.h>
 #  include <dirent.h>
+#  include <sys/mman.h>
 #endif
 
 using namespace std;
@@ -344,6 +345,148 @@ IceUtilInternal::FileLock::~FileLock()
     unlink(_path);
 }
 
+IceUtilInternal::MappedFile::MappedFile(const std::string& path) :
+    _fd(INVALID_HANDLE_VALUE),
+    _mapping(0),
+    _begin(0),
+    _size(0),
+    _path(path)
+{
+#ifdef ICE_OS_WINRT
+    throw IceUtil::SyscallException(__FILE__, __LINE__, ERROR_NOT_SUPPORTED);
+#else
+    _fd = ::CreateFileW(stringToWstring(path, IceUtil::getProcessStringConverter()).c_str(),
+                        GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(_fd == INVALID_HANDLE_VALUE)
+    {
+        throw IceUtil::SyscallException(__FILE__, __LINE__, GetLastError());
+    }
+
+    LARGE_INTEGER sz;
+    if(!::GetFileSizeEx(_fd, &sz))
+    {
+        IceUtil::SyscallException ex(__FILE__, __LINE__, GetLastError());
+        ::CloseHandle(_fd);
+        throw ex;
+    }
+    _size = static_cast<size_t>(sz.QuadPart);
+
+    if(_size > 0)
+    {
+        _mapping = ::CreateFileMappingW(_fd, NULL, PAGE_READONLY, 0, 0, NULL);
+        if(_mapping)
+        {
+            _begin = static_cast<unsigned char*>(::MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        }
+        if(!_begin)
+        {
+            IceUtil::SyscallException ex(__FILE__, __LINE__, GetLastError());
+            unmap();
+            throw ex;
+        }
+    }
+#endif
+}
+
+IceUtilInternal::MappedFile::MappedFile(const std::string& path, size_t size) :
+    _fd(INVALID_HANDLE_VALUE),
+    _mapping(0),
+    _begin(0),
+    _size(size),
+    _path(path)
+{
+#ifdef ICE_OS_WINRT
+    throw IceUtil::SyscallException(__FILE__, __LINE__, ERROR_NOT_SUPPORTED);
+#else
+    _fd = ::CreateFileW(stringToWstring(path, IceUtil::getProcessStringConverter()).c_str(),
+                        GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(_fd == INVALID_HANDLE_VALUE)
+    {
+        throw IceUtil::SyscallException(__FILE__, __LINE__, GetLastError());
+    }
+
+    if(_size > 0)
+    {
+        LARGE_INTEGER sz;
+        sz.QuadPart = static_cast<LONGLONG>(_size);
+        _mapping = ::CreateFileMappingW(_fd, NULL, PAGE_READWRITE, sz.HighPart, sz.LowPart, NULL);
+        if(_mapping)
+        {
+            _begin = static_cast<unsigned char*>(::MapViewOfFile(_mapping, FILE_MAP_WRITE, 0, 0, 0));
+        }
+        if(!_begin)
+        {
+            IceUtil::SyscallException ex(__FILE__, __LINE__, GetLastError());
+            unmap();
+            throw ex;
+        }
+    }
+#endif
+}
+
+IceUtilInternal::MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+void
+IceUtilInternal::MappedFile::finish(const pair<const unsigned char*, const unsigned char*>& data)
+{
+    size_t sz = static_cast<size_t>(data.second - data.first);
+    bool inPlace = _begin && data.first == _begin && sz <= _size;
+    if(_begin)
+    {
+        ::UnmapViewOfFile(_begin);
+        _begin = 0;
+    }
+    if(_mapping)
+    {
+        ::CloseHandle(_mapping);
+        _mapping = 0;
+    }
+
+    LARGE_INTEGER pos;
+    pos.QuadPart = inPlace ? static_cast<LONGLONG>(sz) : 0;
+    if(!::SetFilePointerEx(_fd, pos, 0, FILE_BEGIN) || !::SetEndOfFile(_fd))
+    {
+        throw IceUtil::SyscallException(__FILE__, __LINE__, GetLastError());
+    }
+
+    const unsigned char* p = data.first;
+    while(!inPlace && p < data.second)
+    {
+        DWORD written;
+        size_t left = static_cast<size_t>(data.second - p);
+        DWORD count = left > 0x40000000 ? 0x40000000 : static_cast<DWORD>(left);
+        if(!::WriteFile(_fd, p, count, &written, 0))
+        {
+            throw IceUtil::SyscallException(__FILE__, __LINE__, GetLastError());
+        }
+        p += written;
+    }
+    _size = 0;
+}
+
+void
+IceUtilInternal::MappedFile::unmap()
+{
+    if(_begin)
+    {
+        ::UnmapViewOfFile(_begin);
+        _begin = 0;
+    }
+    if(_mapping)
+    {
+        ::CloseHandle(_mapping);
+        _mapping = 0;
+    }
+    if(_fd != INVALID_HANDLE_VALUE)
+    {
+        ::CloseHandle(_fd);
+        _fd = INVALID_HANDLE_VALUE;
+    }
+}
+
 #ifndef __MINGW32__
 wstring
 IceUtilInternal::streamFilename(const string& filename)
@@ -486,4 +629,120 @@ IceUtilInternal::FileLock::~FileLock()
     unlink(_path);
 }
 
+IceUtilInternal::MappedFile::MappedFile(const std::string& path) :
+    _fd(-1),
+    _begin(0),
+    _size(0),
+    _path(path)
+{
+    _fd = ::open(path.c_str(), O_RDONLY);
+    if(_fd < 0)
+    {
+        throw IceUtil::SyscallException(__FILE__, __LINE__, errno);
+    }
+
+    struct stat buf;
+    if(::fstat(_fd, &buf) == -1)
+    {
+        IceUtil::SyscallException ex(__FILE__, __LINE__, errno);
+        unmap();
+        throw ex;
+    }
+    _size = static_cast<size_t>(buf.st_size);
+
+    if(_size > 0)
+    {
+        void* p = ::mmap(0, _size, PROT_READ, MAP_SHARED, _fd, 0);
+        if(p == MAP_FAILED)
+        {
+            IceUtil::SyscallException ex(__FILE__, __LINE__, errno);
+            unmap();
+            throw ex;
+        }
+        _begin = static_cast<unsigned char*>(p);
+    }
+}
+
+IceUtilInternal::MappedFile::MappedFile(const std::string& path, size_t size) :
+    _fd(-1),
+    _begin(0),
+    _size(size),
+    _path(path)
+{
+    _fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+    if(_fd < 0)
+    {
+        throw IceUtil::SyscallException(__FILE__, __LINE__, errno);
+    }
+
+    if(_size > 0)
+    {
+        void* p = MAP_FAILED;
+        if(::ftruncate(_fd, static_cast<off_t>(_size)) == 0)
+        {
+            p = ::mmap(0, _size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+        }
+        if(p == MAP_FAILED)
+        {
+            IceUtil::SyscallException ex(__FILE__, __LINE__, errno);
+            unmap();
+            throw ex;
+        }
+        _begin = static_cast<unsigned char*>(p);
+    }
+}
+
+IceUtilInternal::MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+void
+IceUtilInternal::MappedFile::finish(const pair<const unsigned char*, const unsigned char*>& data)
+{
+    size_t sz = static_cast<size_t>(data.second - data.first);
+    bool inPlace = _begin && data.first == _begin && sz <= _size;
+    if(_begin)
+    {
+        ::munmap(_begin, _size);
+        _begin = 0;
+    }
+    _size = 0;
+
+    if(::ftruncate(_fd, inPlace ? static_cast<off_t>(sz) : 0) == -1)
+    {
+        throw IceUtil::SyscallException(__FILE__, __LINE__, errno);
+    }
+
+    const unsigned char* p = data.first;
+    while(!inPlace && p < data.second)
+    {
+        ssize_t written = ::write(_fd, p, static_cast<size_t>(data.second - p));
+        if(written == -1)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            throw IceUtil::SyscallException(__FILE__, __LINE__, errno);
+        }
+        p += written;
+    }
+}
+
+void
+IceUtilInternal::MappedFile::unmap()
+{
+    if(_begin)
+    {
+        ::munmap(_begin, _size);
+        _begin = 0;
+    }
+    if(_fd >= 0)
+    {
+        ::close(_fd);
+        _fd = -1;
+    }
+}
+
 #endif
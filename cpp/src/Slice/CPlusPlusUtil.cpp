@@ -142,6 +142,12 @@ sequenceTypeToString(const SequencePtr& seq, const StringList& metaData, int typ
             }
             return "::std::pair<" + s + "::const_iterator, " + s + "::const_iterator>";
         }
+        else if(seqType == "%stream")
+        {
+            string s = typeToString(seq->type(), seq->typeMetaData(),
+                                    (typeCtx & TypeContextCpp11) | (inWstringModule(seq) ? TypeContextUseWstring : 0));
+            return "::Ice::StreamedSequence<" + toTemplateArg(s) + ">";
+        }
         else
         {
             return seqType;
@@ -153,11 +159,26 @@ sequenceTypeToString(const SequencePtr& seq, const StringList& metaData, int typ
     }
 }
 
+string
+flatMapTypeToString(const DictionaryPtr& dict, int typeCtx)
+{
+    //
+    // Only the string, local and mapping flags apply to the key and value types.
+    //
+    typeCtx &= TypeContextUseWstring | TypeContextLocal | TypeContextCpp11;
+    return "::IceUtil::FlatMap<" + toTemplateArg(typeToString(dict->keyType(), dict->keyMetaData(), typeCtx)) +
+        ", " + toTemplateArg(typeToString(dict->valueType(), dict->valueMetaData(), typeCtx)) + ">";
+}
+
 string
 dictionaryTypeToString(const DictionaryPtr& dict, const StringList& metaData, int typeCtx)
 {
     string dictType = findMetaData(metaData, typeCtx);
-    if(!dictType.empty())
+    if(dictType == "flat_map")
+    {
+        return flatMapTypeToString(dict, typeCtx);
+    }
+    else if(!dictType.empty())
     {
         return dictType;
     }
@@ -315,6 +336,63 @@ writeParamEndCode(Output& out, const TypePtr& type, bool optional, const string&
     }
 }
 
+//
+// Returns true if marshaling a value of the given type can grow the stream
+// by an arbitrary amount, in which case the generated code pre-sizes the
+// stream with the wire size estimate of the value.
+//
+bool
+isPresizable(const TypePtr& type, const StringList& metaData)
+{
+    SequencePtr seq = SequencePtr::dynamicCast(type);
+    if(seq)
+    {
+        string seqType = findMetaData(metaData, TypeContextInParam);
+        if(seqType.empty())
+        {
+            seqType = findMetaData(seq->getMetaData(), TypeContextInParam);
+        }
+        return seqType != "%array" && seqType.find("%range") != 0;
+    }
+
+    if(DictionaryPtr::dynamicCast(type))
+    {
+        return true;
+    }
+
+    StructPtr st = StructPtr::dynamicCast(type);
+    return st && st->isVariableLength();
+}
+
+void
+writeReserveCode(Output& out, const ParamDeclList& params, const OperationPtr& op, const string& prefix,
+                 const string& returnValueS, const string& objPrefix)
+{
+    vector<string> estimates;
+    for(ParamDeclList::const_iterator p = params.begin(); p != params.end(); ++p)
+    {
+        if(isPresizable((*p)->type(), (*p)->getMetaData()))
+        {
+            estimates.push_back("::Ice::wireSizeEstimate(" + objPrefix + fixKwd(prefix + (*p)->name()) + ")");
+        }
+    }
+
+    if(op && op->returnType() && !op->returnIsOptional() && isPresizable(op->returnType(), op->getMetaData()))
+    {
+        estimates.push_back("::Ice::wireSizeEstimate(" + objPrefix + returnValueS + ")");
+    }
+
+    if(!estimates.empty())
+    {
+        out << nl << "__os->reserve(__os->pos()";
+        for(vector<string>::const_iterator p = estimates.begin(); p != estimates.end(); ++p)
+        {
+            out << " + " << *p;
+        }
+        out << ");";
+    }
+}
+
 void
 writeMarshalUnmarshalParams(Output& out, const ParamDeclList& params, const OperationPtr& op, bool marshal,
                             bool prepend, int typeCtx, const string& retP = "", const string& obj = "")
@@ -346,6 +424,11 @@ writeMarshalUnmarshalParams(Output& out, const ParamDeclList& params, const Oper
 
     if(!requiredParams.empty() || (op && op->returnType() && !op->returnIsOptional()))
     {
+        if(marshal)
+        {
+            writeReserveCode(out, requiredParams, op, prefix, returnValueS, objPrefix);
+        }
+
         if(cpp11)
         {
             out << nl;
@@ -1647,11 +1730,11 @@ Slice::findMetaData(const StringList& metaData, int typeCtx)
             // is returned.
             // If the form is cpp:view-type:<...> the data after the
             // cpp:view-type: is returned
-            // If the form is cpp:range[:<...>], cpp:array or cpp:class,
+            // If the form is cpp:range[:<...>], cpp:array, cpp:stream or cpp:class,
             // the return value is % followed by the string after cpp:.
             //
             // The priority of the metadata is as follows:
-            // 1: array, range (C++98 only), view-type for "view" parameters
+            // 1: array, range (C++98 only), stream, view-type for "view" parameters
             // 2: class (C++98 only), unscoped (C++11 only)
             //
 
@@ -1687,6 +1770,10 @@ Slice::findMetaData(const StringList& metaData, int typeCtx)
                 {
                     return "%range";
                 }
+                else if(ss == "stream")
+                {
+                    return "%stream";
+                }
             }
             //
             // Otherwise if the data is "class", "unscoped" it is returned.
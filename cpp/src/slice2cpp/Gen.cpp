@@ -372,6 +372,141 @@ condString(bool ok, const string& str)
     return ok ? str : "";
 }
 
+string
+batchArgsStructName(const string& name)
+{
+    assert(!name.empty());
+    return IceUtilInternal::toUpper(name.substr(0, 1)) + name.substr(1) + "Args";
+}
+
+//
+// The servant method of an operation with the cpp:batch metadata receives
+// the arguments of a run of batched requests, one struct per request.
+//
+void
+emitBatchArgsStruct(IceUtilInternal::Output& H, const OperationPtr& p, int typeCtx)
+{
+    H << sp;
+    H << nl << "struct " << batchArgsStructName(p->name());
+    H << sb;
+    ParamDeclList paramList = p->parameters();
+    for(ParamDeclList::const_iterator q = paramList.begin(); q != paramList.end(); ++q)
+    {
+        H << nl << typeToString((*q)->type(), (*q)->optional(), (*q)->getMetaData(), typeCtx) << ' '
+          << fixKwd((*q)->name()) << ';';
+    }
+    H << eb << ';';
+}
+
+void
+writeBatchUnmarshalCode(IceUtilInternal::Output& C, const OperationPtr& p, int typeCtx)
+{
+    string argsName = batchArgsStructName(p->name());
+    ParamDeclList paramList = p->parameters();
+    C << nl << "::std::vector<" << argsName << "> __args;";
+    C << nl << "do";
+    C << sb;
+    C << nl << "__args.push_back(" << argsName << "());";
+    if(!paramList.empty())
+    {
+        if(typeCtx & TypeContextCpp11)
+        {
+            C << nl << "auto __is = __inS.startReadParams();";
+        }
+        else
+        {
+            C << nl << "::Ice::InputStream* __is = __inS.startReadParams();";
+        }
+        writeUnmarshalCode(C, paramList, 0, false, typeCtx, "", "__args.back()");
+        C << nl << "__inS.endReadParams();";
+    }
+    else
+    {
+        C << nl << "__inS.readEmptyParams();";
+    }
+    C << eb;
+    C << nl << "while(__inS.nextBatchRequest());";
+}
+
+//
+// Computes a perfect hash table for the given sorted operation names: the
+// hashString(name, seed) & mask slot of each name holds the position of
+// the name in the list, the remaining slots hold -1.
+//
+void
+computeOperationSlots(const StringList& names, unsigned int& seed, unsigned int& mask, vector<int>& slots)
+{
+    size_t size = 1;
+    while(size < 2 * names.size())
+    {
+        size <<= 1;
+    }
+
+    while(true)
+    {
+        for(seed = 0; seed < 1000; ++seed)
+        {
+            mask = static_cast<unsigned int>(size - 1);
+            slots.assign(size, -1);
+            bool collision = false;
+            int i = 0;
+            for(StringList::const_iterator q = names.begin(); q != names.end() && !collision; ++q, ++i)
+            {
+                int& slot = slots[hashString(*q, seed) & mask];
+                collision = slot != -1;
+                slot = i;
+            }
+            if(!collision)
+            {
+                return;
+            }
+        }
+        size <<= 1;
+    }
+}
+
+//
+// Writes the perfect hash table of the given operation names and returns
+// the call to IceInternal::operationIndex that looks up an operation in it.
+//
+string
+writeOperationSlots(IceUtilInternal::Output& C, const StringList& names, const string& namesTable,
+                    const string& slotsTable, const string& operation, bool define = true)
+{
+    unsigned int seed;
+    unsigned int mask;
+    vector<int> slots;
+    computeOperationSlots(names, seed, mask, slots);
+
+    if(define)
+    {
+        C << nl << "const short " << slotsTable << "[] =";
+        C << sb;
+        for(vector<int>::size_type i = 0; i < slots.size(); ++i)
+        {
+            if(i % 16 == 0)
+            {
+                C << nl;
+            }
+            else
+            {
+                C << ' ';
+            }
+            C << slots[i];
+            if(i + 1 != slots.size())
+            {
+                C << ',';
+            }
+        }
+        C << eb << ';';
+    }
+
+    ostringstream os;
+    os << "::IceInternal::operationIndex(" << operation << ", " << namesTable << ", " << slotsTable << ", "
+       << mask << ", " << seed << ")";
+    return os.str();
+}
+
 }
 
 Slice::Gen::Gen(const string& base, const string& headerExtension, const string& sourceExtension,
@@ -593,7 +728,7 @@ Slice::Gen::generate(const UnitPtr& p)
         H << "\n#include <Ice/GCObject.h>";
         H << "\n#include <Ice/Value.h>";
         H << "\n#include <Ice/Incoming.h>";
-        if(p->hasContentsWithMetaData("amd"))
+        if(p->hasContentsWithMetaData("amd") || p->hasContentsWithMetaData("cpp:coroutine"))
         {
             H << "\n#include <Ice/IncomingAsync.h>";
         }
@@ -634,6 +769,11 @@ Slice::Gen::generate(const UnitPtr& p)
         C << "\n#include <Ice/LocalException.h>";
     }
 
+    if(p->hasContentsWithMetaData("cpp:stream"))
+    {
+        H << "\n#include <Ice/StreamedSequence.h>";
+    }
+
     if(p->hasContentsWithMetaData("preserve-slice"))
     {
         H << "\n#include <Ice/SlicedDataF.h>";
@@ -1437,10 +1577,11 @@ Slice::Gen::TypesVisitor::visitDictionary(const DictionaryPtr& p)
     string name = fixKwd(p->name());
     string dictType = findMetaData(p->getMetaData());
 
-    if(dictType.empty())
+    if(dictType.empty() || dictType == "flat_map")
     {
         //
-        // A default std::map dictionary
+        // A default std::map dictionary, or a sorted vector with the
+        // cpp:type:flat_map metadata
         //
 
         TypePtr keyType = p->keyType();
@@ -1451,8 +1592,13 @@ Slice::Gen::TypesVisitor::visitDictionary(const DictionaryPtr& p)
             ks.insert(0, " ");
         }
         string vs = typeToString(valueType, p->valueMetaData(), _useWstring);
+        if(vs[vs.size() - 1] == '>')
+        {
+            vs += ' ';
+        }
 
-        H << sp << nl << "typedef ::std::map<" << ks << ", " << vs << "> " << name << ';';
+        H << sp << nl << "typedef " << (dictType.empty() ? "::std::map<" : "::IceUtil::FlatMap<") << ks << ", " << vs
+          << "> " << name << ';';
     }
     else
     {
@@ -2515,6 +2661,7 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
             H << nl << "virtual bool __dispatch(::IceInternal::Incoming&, const ::Ice::Current&);";
 
             string flatName = p->flattenedScope() + p->name() + "_all";
+            string slotsName = p->flattenedScope() + p->name() + "_slots";
             C << sp << nl << "namespace";
             C << nl << "{";
             C << nl << "const ::std::string " << flatName << "[] =";
@@ -2529,22 +2676,22 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
                 }
             }
             C << eb << ';';
+            C << sp;
+            string opIndex = writeOperationSlots(C, allOpNames, flatName, slotsName, "current.operation");
             C << sp << nl << "}";
             C << sp;
             C << nl << "bool";
             C << nl << scoped.substr(2) << "::__dispatch(::IceInternal::Incoming& in, const ::Ice::Current& current)";
             C << sb;
 
-            C << nl << "::std::pair< const ::std::string*, const ::std::string*> r = "
-              << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
-              << ", current.operation);";
-            C << nl << "if(r.first == r.second)";
+            C << nl << "int pos = " << opIndex << ';';
+            C << nl << "if(pos < 0)";
             C << sb;
             C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, "
               << "current.facet, current.operation);";
             C << eb;
             C << sp;
-            C << nl << "switch(r.first - " << flatName << ')';
+            C << nl << "switch(pos)";
             C << sb;
             int i = 0;
             for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
@@ -2616,15 +2763,14 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
                   << "::ice_operationAttributes(const ::std::string& opName) const";
                 C << sb;
 
-                C << nl << "::std::pair< const ::std::string*, const ::std::string*> r = "
-                  << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
-                  << ", opName);";
-                C << nl << "if(r.first == r.second)";
+                C << nl << "int pos = " << writeOperationSlots(C, allOpNames, flatName, slotsName, "opName", false)
+                  << ';';
+                C << nl << "if(pos < 0)";
                 C << sb;
                 C << nl << "return -1;";
                 C << eb;
 
-                C << nl << "return " << opAttrFlatName << "[r.first - " << flatName << "];";
+                C << nl << "return " << opAttrFlatName << "[pos];";
                 C << eb;
             }
         }
@@ -2957,9 +3103,22 @@ Slice::Gen::ObjectVisitor::visitOperation(const OperationPtr& p)
 
     string isConst = ((p->mode() == Operation::Nonmutating) || p->hasMetaData("cpp:const")) ? " const" : "";
     bool amd = !cl->isLocal() && (cl->hasMetaData("amd") || p->hasMetaData("amd"));
+    bool batch = !cl->isLocal() && p->hasMetaData("cpp:batch");
 
     string deprecateSymbol = getDeprecateSymbol(p, cl);
 
+    if(batch)
+    {
+        string batchParam = "const ::std::vector<" + batchArgsStructName(name) + ">&";
+        params = "(" + batchParam + ", const ::Ice::Current& = ::Ice::noExplicitCurrent)";
+        args = "(__args, __current)";
+        paramsAMD = "(const " + classScopedAMD + '_' + name + "Ptr&, " + batchParam +
+            ", const ::Ice::Current& = ::Ice::noExplicitCurrent)";
+        argsAMD = "(new IceAsync" + classScopedAMD + '_' + name + "(__inS), __args, __current)";
+
+        emitBatchArgsStruct(H, p, _useWstring);
+    }
+
     H << sp;
     if(!amd)
     {
@@ -2980,7 +3139,11 @@ Slice::Gen::ObjectVisitor::visitOperation(const OperationPtr& p)
         C << sb;
         C << nl << "__checkMode(" << operationModeToString(p->mode()) << ", __current.mode);";
 
-        if(!inParams.empty())
+        if(batch)
+        {
+            writeBatchUnmarshalCode(C, p, 0);
+        }
+        else if(!inParams.empty())
         {
             C << nl << "::Ice::InputStream* __is = __inS.startReadParams();";
             writeAllocateCode(C, inParams, 0, true, _useWstring | TypeContextInParam);
@@ -4412,6 +4575,29 @@ Slice::Gen::StreamVisitor::visitStructStart(const StructPtr& p)
         H << eb << ";" << nl;
 
         writeStreamHelpers(H, p, p->dataMembers(), false, true, false);
+
+        if(p->isVariableLength())
+        {
+            string holder = classMetaData ? "v->" : "v.";
+            DataMemberList dataMembers = p->dataMembers();
+            H << nl << "template<>";
+            H << nl << "struct StreamSizeEstimator< " << fullStructName << ">";
+            H << sb;
+            H << nl << "static Int estimate(const " << fullStructName << "& v)";
+            H << sb;
+            H << nl << "return ";
+            for(DataMemberList::const_iterator q = dataMembers.begin(); q != dataMembers.end(); ++q)
+            {
+                if(q != dataMembers.begin())
+                {
+                    H << " + ";
+                }
+                H << "::Ice::wireSizeEstimate(" << holder << fixKwd((*q)->name()) << ")";
+            }
+            H << ";";
+            H << eb;
+            H << eb << ";" << nl;
+        }
     }
     return false;
 }
@@ -4577,6 +4763,70 @@ Slice::Gen::MetaDataVisitor::visitOperation(const OperationPtr& p)
     StringList metaData = p->getMetaData();
     metaData.remove("cpp:const");
 
+    if(find(metaData.begin(), metaData.end(), "cpp:coroutine") != metaData.end())
+    {
+        metaData.remove("cpp:coroutine");
+        if(cl->isLocal())
+        {
+            emitWarning(p->file(), p->line(), "ignoring invalid metadata `cpp:coroutine': "
+                        "directive applies only to non-local operations");
+        }
+    }
+
+    if(find(metaData.begin(), metaData.end(), "cpp:batch") != metaData.end())
+    {
+        //
+        // Batched requests are dispatched together, the operation can't
+        // return anything and the arguments are copied out of the
+        // request buffer.
+        //
+        metaData.remove("cpp:batch");
+        string reason;
+        bool outParams = false;
+        ParamDeclList params = p->parameters();
+        for(ParamDeclList::const_iterator q = params.begin(); q != params.end(); ++q)
+        {
+            if((*q)->isOutParam())
+            {
+                outParams = true;
+            }
+            StringList paramMetaData = (*q)->getMetaData();
+            for(StringList::const_iterator r = paramMetaData.begin(); r != paramMetaData.end() && reason.empty(); ++r)
+            {
+                if(*r == "cpp:array" || r->find("cpp:range", 0) == 0 || r->find("cpp:view-type:", 0) == 0 ||
+                   *r == "cpp:stream")
+                {
+                    reason = "parameters cannot use the `" + *r + "' metadata";
+                }
+            }
+        }
+
+        if(cl->isLocal())
+        {
+            reason = "directive applies only to non-local operations";
+        }
+        else if(p->returnType() || outParams)
+        {
+            reason = "directive applies only to operations without return value or out-parameters";
+        }
+        else if(cl->hasMetaData("cpp:coroutine") || p->hasMetaData("cpp:coroutine"))
+        {
+            reason = "directive cannot be combined with `cpp:coroutine'";
+        }
+        else if(p->sendsClasses(false))
+        {
+            reason = "parameters cannot use classes";
+        }
+
+        if(!reason.empty())
+        {
+            emitWarning(p->file(), p->line(), "ignoring invalid metadata `cpp:batch': " + reason);
+            StringList opMetaData = p->getMetaData();
+            opMetaData.remove("cpp:batch");
+            p->setMetaData(opMetaData);
+        }
+    }
+
     TypePtr returnType = p->returnType();
     if(!metaData.empty())
     {
@@ -4602,7 +4852,41 @@ Slice::Gen::MetaDataVisitor::visitOperation(const OperationPtr& p)
     ParamDeclList params = p->parameters();
     for(ParamDeclList::iterator q = params.begin(); q != params.end(); ++q)
     {
-        validate((*q)->type(), (*q)->getMetaData(), p->file(), (*q)->line(), ami || !(*q)->isOutParam());
+        StringList paramMetaData = (*q)->getMetaData();
+        if(find(paramMetaData.begin(), paramMetaData.end(), "cpp:stream") != paramMetaData.end())
+        {
+            //
+            // Streamed sequences are unmarshaled on demand from the request
+            // buffer, like cpp:array parameters they are only valid until the
+            // dispatch returns and the elements can't use classes.
+            //
+            SequencePtr seq = SequencePtr::dynamicCast((*q)->type());
+            string reason;
+            if(!seq)
+            {
+                reason = "directive applies only to sequence parameters";
+            }
+            else if((*q)->isOutParam() || (*q)->optional())
+            {
+                reason = "directive applies only to required in-parameters";
+            }
+            else if(cl->isLocal())
+            {
+                reason = "directive applies only to non-local operations";
+            }
+            else if(seq->type()->usesClasses())
+            {
+                reason = "sequence elements cannot use classes";
+            }
+
+            paramMetaData.remove("cpp:stream");
+            if(!reason.empty())
+            {
+                emitWarning(p->file(), (*q)->line(), "ignoring invalid metadata `cpp:stream': " + reason);
+                (*q)->setMetaData(paramMetaData);
+            }
+        }
+        validate((*q)->type(), paramMetaData, p->file(), (*q)->line(), ami || !(*q)->isOutParam());
     }
 }
 
@@ -4684,7 +4968,8 @@ Slice::Gen::MetaDataVisitor::validate(const SyntaxTreeBasePtr& cont, const Strin
                         continue;
                     }
                 }
-                if(BuiltinPtr::dynamicCast(cont) && (ss.find("type:") == 0 || ss.find("view-type:") == 0))
+                if(BuiltinPtr::dynamicCast(cont) && ((ss.find("type:") == 0 && ss != "type:flat_map") ||
+                                                     ss.find("view-type:") == 0))
                 {
                     if(BuiltinPtr::dynamicCast(cont)->kind() == Builtin::KindString)
                     {
@@ -4693,7 +4978,8 @@ Slice::Gen::MetaDataVisitor::validate(const SyntaxTreeBasePtr& cont, const Strin
                 }
                 if(SequencePtr::dynamicCast(cont))
                 {
-                    if(ss.find("type:") == 0 || ss.find("view-type:") == 0 || ss == "array" || ss.find("range") == 0)
+                    if((ss.find("type:") == 0 && ss != "type:flat_map") || ss.find("view-type:") == 0 || ss == "array" ||
+                       ss.find("range") == 0)
                     {
                         continue;
                     }
@@ -4709,7 +4995,7 @@ Slice::Gen::MetaDataVisitor::validate(const SyntaxTreeBasePtr& cont, const Strin
 
                 {
                     ClassDefPtr cl = ClassDefPtr::dynamicCast(cont);
-                    if(cl && ((!cpp11 && ss == "virtual") ||
+                    if(cl && ((!cpp11 && ss == "virtual") || (!cpp98 && !cl->isLocal() && ss == "coroutine") ||
                               (cl->isLocal() && ss.find("type:") == 0) ||
                               (!cpp11 && cl->isLocal() && ss == "comparable")))
                     {
@@ -5158,6 +5444,10 @@ Slice::Gen::Cpp11DeclVisitor::visitClassDefStart(const ClassDefPtr& p)
             }
         }
         C << eb << ';';
+
+        C << sp;
+        writeOperationSlots(C, allOpNames, p->flattenedScope() + p->name() + "_ops",
+                            p->flattenedScope() + p->name() + "_slots", "c.operation");
     }
 
     return true;
@@ -5561,17 +5851,19 @@ Slice::Gen::Cpp11TypesVisitor::visitDictionary(const DictionaryPtr& p)
     string name = fixKwd(p->name());
     string dictType = findMetaData(p->getMetaData());
     int typeCtx = p->isLocal() ? (_useWstring | TypeContextLocal) : _useWstring;
-    if(dictType.empty())
+    if(dictType.empty() || dictType == "flat_map")
     {
         //
-        // A default std::map dictionary
+        // A default std::map dictionary, or a sorted vector with the
+        // cpp:type:flat_map metadata
         //
         TypePtr keyType = p->keyType();
         TypePtr valueType = p->valueType();
         string ks = typeToString(keyType, p->keyMetaData(), typeCtx | TypeContextCpp11);
         string vs = typeToString(valueType, p->valueMetaData(), typeCtx | TypeContextCpp11);
 
-        H << sp << nl << "using " << name << " = ::std::map<" << ks << ", " << vs << ">;";
+        H << sp << nl << "using " << name << " = " << (dictType.empty() ? "::std::map<" : "::IceUtil::FlatMap<") << ks
+          << ", " << vs << ">;";
     }
     else
     {
@@ -5803,12 +6095,62 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
 
     string deprecateSymbol = getDeprecateSymbol(p, cl);
 
+    //
+    // The synchronous operation is dispatched directly to a collocated
+    // servant if the servant method has the same signature as the proxy
+    // method. Operations which send or return classes are always
+    // marshaled, the servant and the caller must not share instances.
+    //
+    bool direct = deprecateSymbol.empty() && !p->hasMarshaledResult() && !p->hasMetaData("cpp:batch") &&
+        !cl->hasMetaData("amd") && !p->hasMetaData("amd") &&
+        !cl->hasMetaData("cpp:coroutine") && !p->hasMetaData("cpp:coroutine") &&
+        !p->sendsClasses(false) && !p->returnsClasses(false);
+    for(ParamDeclList::const_iterator q = inParams.begin(); q != inParams.end() && direct; ++q)
+    {
+        StringList metaData = (*q)->getMetaData();
+        for(StringList::const_iterator r = metaData.begin(); r != metaData.end(); ++r)
+        {
+            if(*r == "cpp:array" || r->find("cpp:range") == 0 || r->find("cpp:view-type:") == 0)
+            {
+                direct = false;
+                break;
+            }
+        }
+    }
+
     //
     // Synchronous operation
     //
     H << sp << nl << deprecateSymbol << retS << ' ' << fixKwd(name) << spar << paramsDecl;
     H << "const ::Ice::Context& __ctx = Ice::noExplicitContext" << epar;
     H << sb;
+    if(direct)
+    {
+        string servant = fixKwd(cl->scope() + cl->name() + (cl->isInterface() ? "" : "Disp"));
+        if(ret)
+        {
+            H << nl << retS << " __ret;";
+        }
+        H << nl << "if(makeDirectCall<" << servant << ">(\"" << name << "\", ";
+        H << operationModeToString(p->sendMode(), true) << ", __ctx,";
+        H.inc();
+        H << nl;
+        throwUserExceptionLambda(H, p->throws());
+        H << ",";
+        H << nl << "[&](" << servant << "* __servant, const ::Ice::Current& __current)";
+        H << sb;
+        H << nl << (ret ? "__ret = " : "") << "__servant->" << fixKwd(name) << spar;
+        for(ParamDeclList::const_iterator q = paramList.begin(); q != paramList.end(); ++q)
+        {
+            H << fixKwd(paramPrefix + (*q)->name());
+        }
+        H << "__current" << epar << ";";
+        H << eb << "))";
+        H.dec();
+        H << sb;
+        H << nl << "return" << (ret ? " __ret" : "") << ";";
+        H << eb;
+    }
     H << nl;
     if(futureOutParams.size() == 1)
     {
@@ -5826,14 +6168,14 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
         H << "auto __result = ";
     }
 
-    H << "makePromiseOutgoing<" << futureT << ">";
+    H << "makeSyncOutgoing<" << futureT << ">";
 
-    H << spar << "true, this" << string("&" + scoped + "__" + name);
+    H << spar << "this" << string("&" + scoped + "__" + name);
     for(ParamDeclList::const_iterator q = inParams.begin(); q != inParams.end(); ++q)
     {
         H << fixKwd(paramPrefix + (*q)->name());
     }
-    H << "__ctx" << epar << ".get();";
+    H << "__ctx" << epar << ";";
     if(futureOutParams.size() > 1)
     {
         for(ParamDeclList::const_iterator q = outParams.begin(); q != outParams.end(); ++q)
@@ -5870,6 +6212,26 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
     H << "__ctx" << epar << ";";
     H << eb;
 
+    //
+    // Coroutine (co_await) based asynchronous operation
+    //
+    H.zeroIndent();
+    H << sp << nl << "#ifdef ICE_COROUTINES";
+    H.restoreIndent();
+    H << nl << deprecateSymbol << "::Ice::Awaitable<" << futureT << "> " << name << "Co" << spar << inParamsDecl;
+    H << "const ::Ice::Context& __ctx = Ice::noExplicitContext" << epar;
+    H << sb;
+    H << nl << "return makeCoroutineOutgoing<" << futureT << ">" << spar;
+    H << "this" << string("&" + scoped + "__" + name);
+    for(ParamDeclList::const_iterator q = inParams.begin(); q != inParams.end(); ++q)
+    {
+        H << fixKwd(paramPrefix + (*q)->name());
+    }
+    H << "__ctx" << epar << ";";
+    H << eb;
+    H.zeroIndent();
+    H << nl << "#endif";
+    H.restoreIndent();
 
     //
     // Lambda based asynchronous operation
@@ -6744,14 +7106,16 @@ Slice::Gen::Cpp11InterfaceVisitor::visitClassDefEnd(const ClassDefPtr& p)
         C << nl << scoped.substr(2) << "::__dispatch(::IceInternal::Incoming& in, const ::Ice::Current& c)";
         C << sb;
 
-        C << nl << "::std::pair< const ::std::string*, const ::std::string*> r = "
-          << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size() << ", c.operation);";
-        C << nl << "if(r.first == r.second)";
+        C << nl << "int pos = "
+          << writeOperationSlots(C, allOpNames, flatName, p->flattenedScope() + p->name() + "_slots", "c.operation",
+                                 false)
+          << ';';
+        C << nl << "if(pos < 0)";
         C << sb;
         C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, c.id, c.facet, c.operation);";
         C << eb;
         C << sp;
-        C << nl << "switch(r.first - " << flatName << ')';
+        C << nl << "switch(pos)";
         C << sb;
         int i = 0;
         for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
@@ -6808,7 +7172,13 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
     string scope = fixKwd(cl->scope() + cl->name() + suffix + "::");
     string scoped = fixKwd(cl->scope() + cl->name() + suffix + "::" + p->name());
 
-    bool amd = (cl->hasMetaData("amd") || p->hasMetaData("amd"));
+    //
+    // Operations with the cpp:coroutine metadata are dispatched
+    // asynchronously, as with amd, through a coroutine servant method when
+    // the compiler supports coroutines.
+    //
+    bool coroutine = (cl->hasMetaData("cpp:coroutine") || p->hasMetaData("cpp:coroutine"));
+    bool amd = (cl->hasMetaData("amd") || p->hasMetaData("amd") || coroutine);
 
     if(p->hasMarshaledResult())
     {
@@ -6836,6 +7206,17 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
         retS = returnTypeToString(ret, p->returnIsOptional(), p->getMetaData(), _useWstring | TypeContextCpp11);
     }
 
+    vector<string> coParamsDecl;
+    vector<string> coArgs;
+    vector<string> coResultTypes;
+    vector<string> coResultFields;
+    string returnValueS = "returnValue";
+    if(ret)
+    {
+        coResultTypes.push_back(returnTypeToString(ret, p->returnIsOptional(), p->getMetaData(),
+                                                   _useWstring | TypeContextCpp11));
+    }
+
     ParamDeclList inParams;
     ParamDeclList outParams;
     ParamDeclList paramList = p->parameters();
@@ -6851,10 +7232,18 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
             inParams.push_back(*q);
             params.push_back(typeToString(type, (*q)->optional(), (*q)->getMetaData(), typeCtx | TypeContextInParam));
             args.push_back(condMove(isMovable(type) && !isOutParam, paramName));
+            coParamsDecl.push_back(params.back() + ' ' + paramName);
+            coArgs.push_back(args.back());
         }
         else
         {
             outParams.push_back(*q);
+            coResultTypes.push_back(typeToString(type, (*q)->optional(), (*q)->getMetaData(), typeCtx));
+            coResultFields.push_back("__r." + fixKwd((*q)->name()));
+            if((*q)->name() == "returnValue")
+            {
+                returnValueS = "_returnValue";
+            }
             if(!p->hasMarshaledResult() && !amd)
             {
                 params.push_back(outputTypeToString(type, (*q)->optional(), (*q)->getMetaData(), typeCtx));
@@ -6866,6 +7255,14 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
             responseParamsDecl.push_back(responseTypeS + " " + paramName);
         }
     }
+    bool batch = p->hasMetaData("cpp:batch");
+    if(batch)
+    {
+        params.clear();
+        args.clear();
+        params.push_back("::std::vector<" + batchArgsStructName(name) + ">");
+        args.push_back("::std::move(__args)");
+    }
     if(amd)
     {
         if(p->hasMarshaledResult())
@@ -6923,8 +7320,66 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
     string opName = amd ? (name + "Async") : fixKwd(name);
     string deprecateSymbol = getDeprecateSymbol(p, cl);
 
+    if(batch)
+    {
+        emitBatchArgsStruct(H, p, _useWstring | TypeContextCpp11);
+    }
+
     H << sp;
+    if(coroutine)
+    {
+        //
+        // With coroutines, the servant implements the <op>Co coroutine and
+        // the AMD method starts it with the response callbacks.
+        //
+        string taskT;
+        string response = "::std::move(__response)";
+        if(p->hasMarshaledResult())
+        {
+            taskT = resultStructName(name, "", true);
+        }
+        else if(coResultTypes.empty())
+        {
+            taskT = "void";
+        }
+        else if(coResultTypes.size() == 1)
+        {
+            taskT = coResultTypes.front();
+        }
+        else
+        {
+            taskT = resultStructName(name, fixKwd(cl->scope() + cl->name()));
+            if(ret)
+            {
+                coResultFields.insert(coResultFields.begin(), "__r." + returnValueS);
+            }
+            response = "[__response](const " + taskT + "& __r) { __response(" + joinString(coResultFields, ", ") + "); }";
+        }
+
+        H.zeroIndent();
+        H << nl << "#ifdef ICE_COROUTINES";
+        H.restoreIndent();
+        H << nl << deprecateSymbol << "virtual ::Ice::DispatchTask<" << taskT << "> " << name << "Co" << spar;
+        H << coParamsDecl << "const ::Ice::Current& = ::Ice::noExplicitCurrent" << epar << isConst << " = 0;";
+        H << sp;
+        H << nl << "virtual void " << opName << spar << coParamsDecl;
+        H << params[params.size() - 3] + " __response" << params[params.size() - 2] + " __exception";
+        H << "const ::Ice::Current& __current" << epar << isConst;
+        H << sb;
+        H << nl << name << "Co" << spar << coArgs << "__current" << epar << ".__dispatch(" << response;
+        H << ", ::std::move(__exception));";
+        H << eb;
+        H.zeroIndent();
+        H << nl << "#else";
+        H.restoreIndent();
+    }
     H << nl << deprecateSymbol << "virtual " << retS << ' ' << opName << spar << params << epar << isConst << " = 0;";
+    if(coroutine)
+    {
+        H.zeroIndent();
+        H << nl << "#endif";
+        H.restoreIndent();
+    }
     H << nl << "bool ___" << name << "(::IceInternal::Incoming&, const ::Ice::Current&)" << isConst << ';';
 
     C << sp;
@@ -6934,7 +7389,11 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
     C << sb;
     C << nl << "__checkMode(" << operationModeToString(p->mode(), true) << ", __current.mode);";
 
-    if(!inParams.empty())
+    if(batch)
+    {
+        writeBatchUnmarshalCode(C, p, _useWstring | TypeContextCpp11);
+    }
+    else if(!inParams.empty())
     {
         C << nl << "auto __is = __inS.startReadParams();";
         writeAllocateCode(C, inParams, 0, true, _useWstring | TypeContextInParam | TypeContextCpp11);
@@ -15,9 +15,196 @@ using namespace std;
 using namespace Ice;
 using namespace Test;
 
+namespace
+{
+
+class EmptyI : public virtual Ice::Object
+{
+};
+
+class ServantMapThread : public IceUtil::Thread
+{
+public:
+
+    ServantMapThread(const ObjectAdapterPtr& adapter, int id, const ObjectPtr& servant,
+                     const ObjectPtr& defaultServant) :
+        _adapter(adapter), _id(id), _servant(servant), _defaultServant(defaultServant)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        const int count = 200;
+        for(int i = 0; i < count; ++i)
+        {
+            Identity ident = identity(i);
+            _adapter->add(_servant, ident);
+            _adapter->addFacet(_servant, ident, "facet");
+            test(_adapter->find(ident) == _servant);
+            test(_adapter->findFacet(ident, "facet") == _servant);
+            test(_adapter->findAllFacets(ident).size() == 2);
+
+            ident.category = "default";
+            test(_adapter->find(ident) == _defaultServant);
+        }
+
+        for(int i = 0; i < count; ++i)
+        {
+            Identity ident = identity(i);
+            test(_adapter->remove(ident) == _servant);
+            test(!_adapter->find(ident));
+            test(_adapter->findFacet(ident, "facet") == _servant);
+            test(_adapter->removeAllFacets(ident).size() == 1);
+            test(!_adapter->findFacet(ident, "facet"));
+        }
+    }
+
+private:
+
+    Identity
+    identity(int i) const
+    {
+        ostringstream os;
+        os << "servant" << i;
+        Identity ident;
+        ident.name = os.str();
+        os.str("");
+        os << "thread" << _id;
+        ident.category = os.str();
+        return ident;
+    }
+
+    const ObjectAdapterPtr _adapter;
+    const int _id;
+    const ObjectPtr _servant;
+    const ObjectPtr _defaultServant;
+};
+
+class PingI : public virtual Ice::Object
+{
+public:
+
+    PingI() : _started(0), _completed(0)
+    {
+    }
+
+    virtual void
+    ice_ping(const Ice::Current&) const
+    {
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+            ++_started;
+            _monitor.notifyAll();
+        }
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+            ++_completed;
+        }
+    }
+
+    void
+    waitForStarted(int count)
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        while(_started < count)
+        {
+            _monitor.wait();
+        }
+    }
+
+    int
+    completed()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        return _completed;
+    }
+
+private:
+
+    mutable IceUtil::Monitor<IceUtil::Mutex> _monitor;
+    mutable int _started;
+    mutable int _completed;
+};
+ICE_DEFINE_PTR(PingIPtr, PingI);
+
+class PingThread : public IceUtil::Thread
+{
+public:
+
+    PingThread(const ObjectPrxPtr& prx) : _prx(prx)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _prx->ice_ping();
+    }
+
+private:
+
+    const ObjectPrxPtr _prx;
+};
+
+}
+
 TestIntfPrxPtr
 allTests(const CommunicatorPtr& communicator)
 {
+    cout << "testing concurrent servant map updates and lookups... " << flush;
+    {
+        ObjectAdapterPtr adapter = communicator->createObjectAdapter("");
+        ObjectPtr servant = ICE_MAKE_SHARED(EmptyI);
+        ObjectPtr defaultServant = ICE_MAKE_SHARED(EmptyI);
+        adapter->addDefaultServant(defaultServant, "default");
+
+        vector<IceUtil::ThreadControl> threads;
+        for(int i = 0; i < 8; ++i)
+        {
+            IceUtil::ThreadPtr thread = new ServantMapThread(adapter, i, servant, defaultServant);
+            threads.push_back(thread->start());
+        }
+        for(vector<IceUtil::ThreadControl>::iterator p = threads.begin(); p != threads.end(); ++p)
+        {
+            p->join();
+        }
+        adapter->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing deactivation with collocated dispatches in progress... " << flush;
+    {
+        string host = communicator->getProperties()->getPropertyAsIntWithDefault("Ice.IPv6", 0) == 0 ?
+            "127.0.0.1" : "\"0:0:0:0:0:0:0:1\"";
+        ObjectAdapterPtr adapter =
+            communicator->createObjectAdapterWithEndpoints("PingTestAdapter", "default -h " + host);
+        adapter->activate();
+        PingIPtr servant = ICE_MAKE_SHARED(PingI);
+        ObjectPrxPtr prx = adapter->addWithUUID(servant);
+
+        const int count = 8;
+        vector<IceUtil::ThreadControl> threads;
+        for(int i = 0; i < count; ++i)
+        {
+            IceUtil::ThreadPtr thread = new PingThread(prx);
+            threads.push_back(thread->start());
+        }
+        servant->waitForStarted(count);
+
+        adapter->deactivate();
+        adapter->waitForDeactivate();
+        test(servant->completed() == count);
+
+        for(vector<IceUtil::ThreadControl>::iterator p = threads.begin(); p != threads.end(); ++p)
+        {
+            p->join();
+        }
+        adapter->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing stringToProxy... " << flush;
     ObjectPrxPtr base = communicator->stringToProxy("test:" + getTestEndpoint(communicator, 0));
     test(base);
@@ -881,6 +881,89 @@ private:
 typedef IceUtil::Handle<Thrower> ThrowerPtr;
 #endif
 
+#ifdef ICE_COROUTINES
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object()
+        {
+            return Detached();
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return std::suspend_never();
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return std::suspend_never();
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            terminate();
+        }
+    };
+};
+
+Detached
+coroutineCalls(shared_ptr<Test::TestIntfPrx> p, Ice::Context ctx, promise<void>& done)
+{
+    try
+    {
+        co_await p->opCo();
+        co_await p->opCo(ctx);
+
+        test(co_await p->opWithResultCo() == 15);
+        test(co_await p->opWithResultCo(ctx) == 15);
+
+        try
+        {
+            co_await p->opWithUECo();
+            test(false);
+        }
+        catch(const Test::TestIntfException&)
+        {
+        }
+
+        auto r = co_await p->opCoroutineCo(5);
+        test(r.returnValue == 6 && r.twice == 10);
+
+        try
+        {
+            co_await p->opCoroutineCo(-1);
+            test(false);
+        }
+        catch(const Test::TestIntfException&)
+        {
+        }
+
+        co_await p->ice_oneway()->opCo();
+
+        try
+        {
+            co_await p->ice_adapterId("dummy")->opCo();
+            test(false);
+        }
+        catch(const Ice::NoEndpointException&)
+        {
+        }
+
+        done.set_value();
+    }
+    catch(...)
+    {
+        done.set_exception(current_exception());
+    }
+}
+#endif
+
 }
 
 void
@@ -1354,6 +1437,16 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
     }
     cout << "ok" << endl;
 
+#ifdef ICE_COROUTINES
+    cout << "testing coroutine API... " << flush;
+    {
+        promise<void> done;
+        coroutineCalls(p, ctx, done);
+        done.get_future().get();
+    }
+    cout << "ok" << endl;
+#endif
+
     cout << "testing local exceptions with lambda API... " << flush;
     {
         auto indirect = Ice::uncheckedCast<Test::TestIntfPrx>(p->ice_adapterId("dummy"));
@@ -2094,6 +2187,89 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
         }
         cout << "ok" << endl;
 
+        cout << "testing batch twoway requests... " << flush;
+        {
+            auto b1 = p->ice_batchTwoway();
+            test(b1->ice_isBatchTwoway() && b1->ice_isTwoway());
+            test(b1->ice_batchTwoway() == b1);
+            test(!b1->ice_twoway()->ice_isBatchTwoway() && Ice::targetEqualTo(b1->ice_twoway(), p->ice_twoway()));
+            test(!b1->ice_oneway()->ice_isBatchTwoway() && b1->ice_oneway()->ice_isOneway());
+
+            //
+            // The requests are only sent when the batch is flushed and each
+            // request gets its own reply, including the exception.
+            //
+            vector<future<int>> results;
+            for(int i = 0; i < 10; ++i)
+            {
+                results.push_back(b1->opWithResultAsync());
+            }
+            auto ue = b1->opWithUEAsync();
+            auto r = b1->opWithResultAsync();
+            test(r.wait_for(chrono::milliseconds(50)) == future_status::timeout);
+            b1->ice_flushBatchRequests();
+            for(auto& f : results)
+            {
+                test(f.get() == 15);
+            }
+            try
+            {
+                ue.get();
+                test(false);
+            }
+            catch(const Test::TestIntfException&)
+            {
+            }
+            test(r.get() == 15);
+
+            //
+            // A synchronous invocation flushes the queued requests.
+            //
+            r = b1->opWithResultAsync();
+            test(b1->opWithResult() == 15);
+            test(r.get() == 15);
+
+            //
+            // A queued request can be canceled without affecting the others.
+            //
+            r = b1->opWithResultAsync();
+            promise<void> canceled;
+            auto cancel = b1->opWithResultAsync(
+                [](int)
+                {
+                    test(false);
+                },
+                [&](exception_ptr ex)
+                {
+                    try
+                    {
+                        rethrow_exception(ex);
+                    }
+                    catch(const Ice::InvocationCanceledException&)
+                    {
+                        canceled.set_value();
+                    }
+                    catch(...)
+                    {
+                        test(false);
+                    }
+                });
+            cancel();
+            canceled.get_future().get();
+            p->ice_getConnection()->flushBatchRequests();
+            test(r.get() == 15);
+
+            //
+            // Queued requests are retried if the connection is closed before
+            // the batch is flushed.
+            //
+            r = b1->opWithResultAsync();
+            b1->ice_getConnection()->close(false);
+            b1->ice_flushBatchRequests();
+            test(r.get() == 15);
+        }
+        cout << "ok" << endl;
+
         cout << "testing cancel operations... " << flush;
         {
             if(p->ice_getConnection())
@@ -3517,6 +3693,63 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
             }
         }
         cout << "ok" << endl;
+
+        cout << "testing batch twoway requests... " << flush;
+        {
+            Test::TestIntfPrx b1 = p->ice_batchTwoway();
+            test(b1->ice_isBatchTwoway() && b1->ice_isTwoway());
+            test(b1->ice_batchTwoway() == b1);
+            test(!b1->ice_twoway()->ice_isBatchTwoway() && b1->ice_twoway() == p->ice_twoway());
+            test(!b1->ice_oneway()->ice_isBatchTwoway() && b1->ice_oneway()->ice_isOneway());
+
+            vector<Ice::AsyncResultPtr> results;
+            for(int i = 0; i < 10; ++i)
+            {
+                results.push_back(b1->begin_opWithResult());
+            }
+            Ice::AsyncResultPtr ue = b1->begin_opWithUE();
+            Ice::AsyncResultPtr r = b1->begin_opWithResult();
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(50));
+            test(!r->isSent() && !r->isCompleted());
+            b1->ice_flushBatchRequests();
+            for(vector<Ice::AsyncResultPtr>::const_iterator q = results.begin(); q != results.end(); ++q)
+            {
+                test(b1->end_opWithResult(*q) == 15);
+            }
+            try
+            {
+                b1->end_opWithUE(ue);
+                test(false);
+            }
+            catch(const Test::TestIntfException&)
+            {
+            }
+            test(b1->end_opWithResult(r) == 15);
+
+            r = b1->begin_opWithResult();
+            test(b1->opWithResult() == 15);
+            test(b1->end_opWithResult(r) == 15);
+
+            r = b1->begin_opWithResult();
+            Ice::AsyncResultPtr r2 = b1->begin_opWithResult();
+            r2->cancel();
+            p->ice_getConnection()->flushBatchRequests();
+            test(b1->end_opWithResult(r) == 15);
+            try
+            {
+                b1->end_opWithResult(r2);
+                test(false);
+            }
+            catch(const Ice::InvocationCanceledException&)
+            {
+            }
+
+            r = b1->begin_opWithResult();
+            b1->ice_getConnection()->close(false);
+            b1->ice_flushBatchRequests();
+            test(b1->end_opWithResult(r) == 15);
+        }
+        cout << "ok" << endl;
     }
     cout << "testing AsyncResult operations... " << flush;
     {
@@ -41,6 +41,51 @@ TestIntfI::opWithResultAndUE(const Ice::Current&)
     throw Test::TestIntfException();
 }
 
+#if defined(ICE_COROUTINES)
+Ice::DispatchTask<Test::TestIntf::OpCoroutineResult>
+TestIntfI::opCoroutineCo(int value, const Ice::Current& current)
+{
+    if(value < 0)
+    {
+        throw Test::TestIntfException();
+    }
+
+    //
+    // Await a call on this servant, the dispatch thread is released while
+    // the coroutine is suspended.
+    //
+    auto self = Ice::uncheckedCast<Test::TestIntfPrx>(current.adapter->createProxy(current.id));
+    int result = co_await self->opWithResultCo();
+    test(result == 15);
+    co_return Test::TestIntf::OpCoroutineResult { value + 1, value * 2 };
+}
+#elif defined(ICE_CPP11_MAPPING)
+void
+TestIntfI::opCoroutineAsync(int value, std::function<void(int, int)> response,
+                            std::function<void(std::exception_ptr)> exception, const Ice::Current&)
+{
+    if(value < 0)
+    {
+        exception(std::make_exception_ptr(Test::TestIntfException()));
+    }
+    else
+    {
+        response(value + 1, value * 2);
+    }
+}
+#else
+int
+TestIntfI::opCoroutine(int value, int& twice, const Ice::Current&)
+{
+    if(value < 0)
+    {
+        throw Test::TestIntfException();
+    }
+    twice = value * 2;
+    return value + 1;
+}
+#endif
+
 void
 TestIntfI::opWithPayload(ICE_IN(Ice::ByteSeq), const Ice::Current&)
 {
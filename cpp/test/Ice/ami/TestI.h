@@ -28,6 +28,14 @@ public:
     virtual int opWithResultAndUE(const Ice::Current&);
     virtual void opWithPayload(ICE_IN(Ice::ByteSeq), const Ice::Current&);
     virtual void opBatch(const Ice::Current&);
+#if defined(ICE_COROUTINES)
+    virtual Ice::DispatchTask<Test::TestIntf::OpCoroutineResult> opCoroutineCo(int, const Ice::Current&);
+#elif defined(ICE_CPP11_MAPPING)
+    virtual void opCoroutineAsync(int, std::function<void(int, int)>, std::function<void(std::exception_ptr)>,
+                                  const Ice::Current&);
+#else
+    virtual int opCoroutine(int, int&, const Ice::Current&);
+#endif
     virtual Ice::Int opBatchCount(const Ice::Current&);
     virtual void opWithArgs(Ice::Int&, Ice::Int&, Ice::Int&, Ice::Int&, Ice::Int&, Ice::Int&, Ice::Int&,
                             Ice::Int&, Ice::Int&, Ice::Int&, Ice::Int&, const Ice::Current&);
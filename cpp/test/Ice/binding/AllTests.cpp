@@ -100,6 +100,21 @@ deactivate(const RemoteCommunicatorPrxPtr& com, vector<RemoteObjectAdapterPrxPtr
     }
 }
 
+Ice::CircuitBreakerInfo
+getCircuitBreakerInfo(const Ice::CircuitBreakerAdminPtr& admin, const string& endpoint)
+{
+    Ice::CircuitBreakerInfoSeq infos = admin->getCircuitBreakers(Ice::Current());
+    for(Ice::CircuitBreakerInfoSeq::const_iterator p = infos.begin(); p != infos.end(); ++p)
+    {
+        if(p->endpoint == endpoint)
+        {
+            return *p;
+        }
+    }
+    test(false);
+    return Ice::CircuitBreakerInfo();
+}
+
 void
 allTests(const Ice::CommunicatorPtr& communicator)
 {
@@ -805,6 +820,166 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing per request binding and adaptive endpoint selection... " << flush;
+    {
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter101", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter102", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter103", "default"));
+
+        TestIntfPrxPtr test = createTestIntfPrx(adapters);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpointSelection(Ice::Adaptive));
+        test(test->ice_getEndpointSelection() == Ice::Adaptive);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_connectionCached(false));
+
+        //
+        // Endpoints which didn't receive requests yet are the least
+        // loaded, each request is sent to a new endpoint until all the
+        // endpoints are used.
+        //
+        set<string> names;
+        names.insert(test->getAdapterName());
+        names.insert(test->getAdapterName());
+        names.insert(getAdapterNameWithAMI(test));
+        test(names.size() == 3);
+
+        //
+        // An endpoint which can't be connected is no longer used.
+        //
+        string name = test->getAdapterName();
+        for(vector<RemoteObjectAdapterPrxPtr>::iterator p = adapters.begin(); p != adapters.end(); ++p)
+        {
+            if((*p)->getTestIntf()->getAdapterName() == name)
+            {
+                com->deactivateObjectAdapter(*p);
+                adapters.erase(p);
+                break;
+            }
+        }
+        for(int i = 0; i < 10; ++i)
+        {
+            test(test->getAdapterName() != name);
+        }
+
+        deactivate(com, adapters);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing circuit breakers... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.CircuitBreaker.FailureThreshold", "1");
+        initData.properties->setProperty("Ice.CircuitBreaker.OpenTimeout", "500");
+        initData.properties->setProperty("Ice.Admin.Enabled", "1");
+        Ice::CommunicatorHolder ich = Ice::initialize(initData);
+        Ice::CircuitBreakerAdminPtr admin =
+            ICE_DYNAMIC_CAST(Ice::CircuitBreakerAdmin, ich->findAdminFacet("CircuitBreaker"));
+        test(admin);
+        test(admin->getCircuitBreakers(Ice::Current()).empty());
+
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter111", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter112", "default"));
+
+        TestIntfPrxPtr test = createTestIntfPrx(adapters);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, ich->stringToProxy(communicator->proxyToString(test)));
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpointSelection(Ice::Ordered));
+        string endpoint1 = test->ice_getEndpoints()[0]->toString();
+        string endpoint2 = test->ice_getEndpoints()[1]->toString();
+
+        //
+        // The circuit of the first endpoint opens once the connection
+        // establishment fails, the endpoint is skipped until the open
+        // timeout expires.
+        //
+        com->deactivateObjectAdapter(adapters[0]);
+        test(test->getAdapterName() == "Adapter112");
+        Ice::CircuitBreakerInfo info = getCircuitBreakerInfo(admin, endpoint1);
+        test(info.state == Ice::ICE_ENUM(CircuitBreakerState, CircuitOpen));
+        test(info.failures == 1);
+        info = getCircuitBreakerInfo(admin, endpoint2);
+        test(info.state == Ice::ICE_ENUM(CircuitBreakerState, CircuitClosed));
+        test(info.failures == 0);
+
+        adapters[0] = com->createObjectAdapter("Adapter111", endpoint1);
+        test->ice_getConnection()->close(false);
+        test(test->getAdapterName() == "Adapter112");
+
+        //
+        // Once the open timeout expired, a connection attempt probes the
+        // endpoint and closes the circuit.
+        //
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(600));
+        test->ice_getConnection()->close(false);
+        test(test->getAdapterName() == "Adapter111");
+        info = getCircuitBreakerInfo(admin, endpoint1);
+        test(info.state == Ice::ICE_ENUM(CircuitBreakerState, CircuitClosed));
+        test(info.failures == 0);
+
+        //
+        // If the circuits of all the endpoints are open, the invocation
+        // fails without trying to establish a connection.
+        //
+        test->ice_getConnection()->close(false);
+        deactivate(com, adapters);
+        for(int i = 0; i < 2; ++i)
+        {
+            try
+            {
+                test->ice_ping();
+                test(false);
+            }
+            catch(const Ice::LocalException&)
+            {
+            }
+            info = getCircuitBreakerInfo(admin, endpoint1);
+            test(info.state == Ice::ICE_ENUM(CircuitBreakerState, CircuitOpen));
+            test(info.failures == 1);
+            info = getCircuitBreakerInfo(admin, endpoint2);
+            test(info.state == Ice::ICE_ENUM(CircuitBreakerState, CircuitOpen));
+            test(info.failures == 1);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing request handler sharing... " << flush;
+    {
+        RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter91", "default");
+
+        //
+        // Proxies derived with settings which don't affect the connection
+        // share the connection of the proxy they're derived from.
+        //
+        TestIntfPrxPtr test1 = adapter->getTestIntf();
+        test1->ice_ping();
+        Ice::Context ctx;
+        ctx["one"] = "hello";
+        TestIntfPrxPtr test2 = ICE_UNCHECKED_CAST(TestIntfPrx, test1->ice_context(ctx)->ice_invocationTimeout(10000));
+        test(test2->getAdapterName() == "Adapter91");
+        test(test2->ice_getCachedConnection() == test1->ice_getCachedConnection());
+
+        //
+        // Once the connection is closed, new proxies establish a new
+        // connection instead of using the closed one.
+        //
+        Ice::ConnectionPtr connection = test1->ice_getConnection();
+        connection->close(false);
+        TestIntfPrxPtr test3 = ICE_UNCHECKED_CAST(TestIntfPrx, test1->ice_context(ctx));
+        test(test3->getAdapterName() == "Adapter91");
+        test(test3->ice_getCachedConnection() != connection);
+
+        //
+        // Proxies which don't cache their connection don't share it.
+        //
+        TestIntfPrxPtr test4 = ICE_UNCHECKED_CAST(TestIntfPrx, test3->ice_connectionCached(false));
+        test4->ice_ping();
+        test(!test4->ice_getCachedConnection());
+
+        com->deactivateObjectAdapter(adapter);
+    }
+    cout << "ok" << endl;
+
     cout << "testing endpoint mode filtering... " << flush;
     {
         vector<RemoteObjectAdapterPrxPtr> adapters;
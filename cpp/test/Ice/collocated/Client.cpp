@@ -0,0 +1,313 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <Test.h>
+#include <TestCommon.h>
+
+using namespace std;
+using namespace Test;
+
+DEFINE_TEST("client")
+
+namespace
+{
+
+class TestI : public TestIntf
+{
+public:
+
+    TestI() :
+        _proxy(0)
+    {
+    }
+
+    virtual void
+    op(const Ice::Current& current)
+    {
+        _lastCurrent = current;
+    }
+
+    virtual Ice::Int
+    opInt(Ice::Int i, Ice::Int& o, const Ice::Current& current)
+    {
+        _lastCurrent = current;
+        o = i;
+        return i + 1;
+    }
+
+    virtual IntSeq
+    opIntSeq(ICE_IN(IntSeq) s, IntSeq& o, const Ice::Current&)
+    {
+        o = s;
+        return IntSeq(s.rbegin(), s.rend());
+    }
+
+    virtual void
+    opProxy(ICE_IN(TestIntfPrxPtr) p, const Ice::Current&)
+    {
+        _proxy = p.get();
+    }
+
+    virtual void
+    throwDeclared(const Ice::Current&)
+    {
+        throw TestException("declared");
+    }
+
+    virtual void
+    throwUndeclared(const Ice::Current&)
+    {
+        throw UndeclaredException();
+    }
+
+    virtual void
+    throwLocal(const Ice::Current&)
+    {
+        throw Ice::TimeoutException(__FILE__, __LINE__);
+    }
+
+    virtual void
+    throwObjectNotExist(const Ice::Current&)
+    {
+        throw Ice::ObjectNotExistException(__FILE__, __LINE__);
+    }
+
+    const Ice::Current&
+    lastCurrent() const
+    {
+        return _lastCurrent;
+    }
+
+    const void*
+    lastProxy() const
+    {
+        return _proxy;
+    }
+
+private:
+
+    Ice::Current _lastCurrent;
+    const void* _proxy;
+};
+ICE_DEFINE_PTR(TestIPtr, TestI);
+
+class InterceptorI : public Ice::DispatchInterceptor
+{
+public:
+
+    InterceptorI(const Ice::ObjectPtr& servant) :
+        _servant(servant)
+    {
+    }
+
+    virtual bool
+    dispatch(Ice::Request& request)
+    {
+        return _servant->ice_dispatch(request);
+    }
+
+private:
+
+    const Ice::ObjectPtr _servant;
+};
+
+void
+testExceptions(const TestIntfPrxPtr& p)
+{
+    try
+    {
+        p->throwDeclared();
+        test(false);
+    }
+    catch(const TestException& ex)
+    {
+        test(ex.reason == "declared");
+    }
+
+    try
+    {
+        p->throwUndeclared();
+        test(false);
+    }
+    catch(const Ice::UnknownUserException& ex)
+    {
+        test(ex.unknown == "::Test::UndeclaredException");
+    }
+
+    try
+    {
+        p->throwLocal();
+        test(false);
+    }
+    catch(const Ice::UnknownLocalException& ex)
+    {
+        test(ex.unknown.find("Ice::TimeoutException") != string::npos);
+    }
+
+    try
+    {
+        p->throwObjectNotExist();
+        test(false);
+    }
+    catch(const Ice::ObjectNotExistException& ex)
+    {
+        test(ex.id == p->ice_getIdentity());
+        test(ex.facet.empty());
+        test(ex.operation == "throwObjectNotExist");
+    }
+}
+
+double
+timeCalls(const TestIntfPrxPtr& p, const IntSeq& seq, int count)
+{
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < count; ++i)
+    {
+        if(seq.empty())
+        {
+            p->op();
+        }
+        else
+        {
+            IntSeq o;
+            p->opIntSeq(seq, o);
+        }
+    }
+    return (IceUtil::Time::now(IceUtil::Time::Monotonic) - start).toMicroSecondsDouble() / count;
+}
+
+}
+
+int
+run(int, char**, const Ice::CommunicatorPtr& communicator)
+{
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint(communicator, 0));
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    TestIPtr servant = ICE_MAKE_SHARED(TestI);
+    TestIntfPrxPtr direct = ICE_UNCHECKED_CAST(TestIntfPrx, adapter->add(servant, Ice::stringToIdentity("test")));
+    TestIntfPrxPtr intercepted = ICE_UNCHECKED_CAST(TestIntfPrx,
+                                                    adapter->add(ICE_MAKE_SHARED(InterceptorI, servant),
+                                                                 Ice::stringToIdentity("intercepted")));
+
+    cout << "testing collocated invocations... " << flush;
+    {
+        Ice::Int o;
+        test(direct->opInt(1, o) == 2 && o == 1);
+        test(intercepted->opInt(2, o) == 3 && o == 2);
+
+        IntSeq s;
+        s.push_back(1);
+        s.push_back(2);
+        IntSeq so;
+        IntSeq r = direct->opIntSeq(s, so);
+        test(so == s && r.size() == 2 && r[0] == 2 && r[1] == 1);
+        r = intercepted->opIntSeq(s, so);
+        test(so == s && r.size() == 2 && r[0] == 2 && r[1] == 1);
+
+        Ice::Context ctx;
+        ctx["a"] = "b";
+        direct->op(ctx);
+        test(servant->lastCurrent().ctx == ctx);
+        test(servant->lastCurrent().operation == "op");
+        test(servant->lastCurrent().id == direct->ice_getIdentity());
+        test(servant->lastCurrent().adapter == adapter);
+        intercepted->op(ctx);
+        test(servant->lastCurrent().ctx == ctx);
+        test(servant->lastCurrent().id == intercepted->ice_getIdentity());
+    }
+    cout << "ok" << endl;
+
+#ifdef ICE_CPP11_MAPPING
+    cout << "testing direct dispatch... " << flush;
+    {
+        //
+        // Synchronous twoway invocations on a collocated servant are
+        // dispatched directly, without marshaling the parameters. The
+        // servant receives the caller's proxy rather than a copy
+        // unmarshaled from the request.
+        //
+        direct->opProxy(direct);
+        test(servant->lastProxy() == direct.get());
+        direct->op();
+        test(servant->lastCurrent().requestId == -1);
+        test(!servant->lastCurrent().con);
+
+        //
+        // Servants that don't implement the interface, such as dispatch
+        // interceptors, and asynchronous invocations use the marshaled
+        // collocated path.
+        //
+        intercepted->opProxy(direct);
+        test(servant->lastProxy() != direct.get());
+        intercepted->op();
+        test(servant->lastCurrent().requestId != -1);
+        direct->opAsync().get();
+        test(servant->lastCurrent().requestId != -1);
+
+        //
+        // Invocation timeouts can't be enforced by a direct dispatch.
+        //
+        direct->ice_invocationTimeout(10000)->op();
+        test(servant->lastCurrent().requestId != -1);
+    }
+    cout << "ok" << endl;
+#endif
+
+    cout << "testing exceptions... " << flush;
+    testExceptions(direct);
+    testExceptions(intercepted);
+    cout << "ok" << endl;
+
+    cout << "testing collocated invocation latency... " << flush;
+    {
+        const int count = 20000;
+        IntSeq seq(100);
+        for(int i = 0; i < 100; ++i)
+        {
+            seq[i] = i;
+        }
+
+        timeCalls(direct, IntSeq(), 1000); // Warm up
+        timeCalls(intercepted, IntSeq(), 1000);
+
+        double directOp = timeCalls(direct, IntSeq(), count);
+        double interceptedOp = timeCalls(intercepted, IntSeq(), count);
+        double directSeq = timeCalls(direct, seq, count / 2);
+        double interceptedSeq = timeCalls(intercepted, seq, count / 2);
+        cout << "ok" << endl;
+        cout << "    op():       " << directOp << "us (servant), " << interceptedOp << "us (interceptor)" << endl;
+        cout << "    opIntSeq(): " << directSeq << "us (servant), " << interceptedSeq << "us (interceptor)" << endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int
+main(int argc, char* argv[])
+{
+#ifdef ICE_STATIC_LIBS
+    Ice::registerIceSSL();
+#endif
+
+    try
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties(argc, argv);
+        initData.properties->setProperty("Ice.Warn.Dispatch", "0");
+
+        Ice::CommunicatorHolder ich = Ice::initialize(argc, argv, initData);
+        return run(argc, argv, ich.communicator());
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        return  EXIT_FAILURE;
+    }
+}
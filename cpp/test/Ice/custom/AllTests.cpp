@@ -54,6 +54,30 @@ arrayRangeEquals(pair<const T*, const T*> lhs, pair<const T*, const T*> rhs)
     return true;
 }
 
+class FixedProducer : public Ice::SequenceProducer<Test::Fixed>
+{
+public:
+
+    FixedProducer(Ice::Int count) :
+        _count(count)
+    {
+    }
+
+    virtual void produce(Ice::SequenceOutput<Test::Fixed>& out)
+    {
+        Test::Fixed f;
+        for(Ice::Int i = 0; i < _count; ++i)
+        {
+            f.s = static_cast<Ice::Short>(i);
+            out.write(f);
+        }
+    }
+
+private:
+
+    const Ice::Int _count;
+};
+
 }
 
 #ifndef ICE_CPP11_MAPPING
@@ -821,6 +845,82 @@ allTests(const Ice::CommunicatorPtr& communicator)
         test(ret == in);
     }
 
+    {
+        FixedProducer producer(1000);
+        Test::FixedSeq ret = t->opFixedStream(Ice::StreamedSequence<Test::Fixed>(1000, producer));
+        test(ret.size() == 1000);
+        for(Ice::Int i = 0; i < 1000; ++i)
+        {
+            test(ret[i].s == static_cast<Ice::Short>(i));
+        }
+
+        ret = t->opFixedStream(Ice::StreamedSequence<Test::Fixed>());
+        test(ret.empty());
+
+        try
+        {
+            t->opFixedStream(Ice::StreamedSequence<Test::Fixed>(1001, producer));
+            test(false);
+        }
+        catch(const Ice::MarshalException&)
+        {
+        }
+    }
+
+    {
+        Test::VariableSeq in;
+        Test::Variable v;
+        v.s = "These";
+        in.push_back(v);
+        v.s = "are";
+        in.push_back(v);
+        v.s = "five";
+        in.push_back(v);
+        v.s = "short";
+        in.push_back(v);
+        v.s = "strings.";
+        in.push_back(v);
+        string outTail;
+#ifdef ICE_CPP11_MAPPING
+        Test::VariableSeq ret = t->opVariableStream(
+            Ice::StreamedSequence<Test::Variable>(5, [&in](Ice::SequenceOutput<Test::Variable>& out)
+                                                     {
+                                                         for(const auto& p : in)
+                                                         {
+                                                             out.write(p);
+                                                         }
+                                                     }),
+            "tail", outTail);
+#else
+        class VariableProducer : public Ice::SequenceProducer<Test::Variable>
+        {
+        public:
+
+            VariableProducer(const Test::VariableSeq& seq) :
+                _seq(seq)
+            {
+            }
+
+            virtual void produce(Ice::SequenceOutput<Test::Variable>& out)
+            {
+                for(Test::VariableSeq::const_iterator p = _seq.begin(); p != _seq.end(); ++p)
+                {
+                    out.write(*p);
+                }
+            }
+
+        private:
+
+            const Test::VariableSeq& _seq;
+        };
+        VariableProducer producer(in);
+        Test::VariableSeq ret = t->opVariableStream(Ice::StreamedSequence<Test::Variable>(5, producer), "tail",
+                                                    outTail);
+#endif
+        test(ret == in);
+        test(outTail == "tail");
+    }
+
     {
         deque<bool> in(5);
         in[0] = false;
@@ -95,6 +95,22 @@ TestIntfI::opVariableRangeTypeAsync(Test::VariableList in,
     response(in, in);
 }
 
+void
+TestIntfI::opFixedStreamAsync(Ice::StreamedSequence<Test::Fixed> in,
+                              std::function<void(const Test::FixedSeq&)> response,
+                              std::function<void(std::exception_ptr)>, const Ice::Current&)
+{
+    response(Test::FixedSeq(in.begin(), in.end()));
+}
+
+void
+TestIntfI::opVariableStreamAsync(Ice::StreamedSequence<Test::Variable> in, std::string tail,
+                                 std::function<void(const Test::VariableSeq&, const std::string&)> response,
+                                 std::function<void(std::exception_ptr)>, const Ice::Current&)
+{
+    response(Test::VariableSeq(in.begin(), in.end()), tail);
+}
+
 void
 TestIntfI::opBoolSeqAsync(std::deque<bool> in,
                           std::function<void(const std::deque<bool>&, const std::deque<bool>&)> response,
@@ -441,6 +457,23 @@ TestIntfI::opVariableRangeType_async(const Test::AMD_TestIntf_opVariableRangeTyp
     opVariableRangeTypeCB->ice_response(outSeq, outSeq);
 }
 
+void
+TestIntfI::opFixedStream_async(const Test::AMD_TestIntf_opFixedStreamPtr& opFixedStreamCB,
+                               const Ice::StreamedSequence<Test::Fixed>& inSeq,
+                               const Ice::Current&)
+{
+    opFixedStreamCB->ice_response(Test::FixedSeq(inSeq.begin(), inSeq.end()));
+}
+
+void
+TestIntfI::opVariableStream_async(const Test::AMD_TestIntf_opVariableStreamPtr& opVariableStreamCB,
+                                  const Ice::StreamedSequence<Test::Variable>& inSeq,
+                                  const std::string& tail,
+                                  const Ice::Current&)
+{
+    opVariableStreamCB->ice_response(Test::VariableSeq(inSeq.begin(), inSeq.end()), tail);
+}
+
 void
 TestIntfI::opBoolSeq_async(const Test::AMD_TestIntf_opBoolSeqPtr& opBoolSeqCB,
                            const std::deque<bool>& inSeq,
@@ -63,6 +63,14 @@ public:
                                                       const ::Test::VariableList&)>,
                                   std::function<void(std::exception_ptr)>, const Ice::Current&) override;
 
+    void opFixedStreamAsync(Ice::StreamedSequence<Test::Fixed>,
+                            std::function<void(const ::Test::FixedSeq&)>,
+                            std::function<void(std::exception_ptr)>, const Ice::Current&) override;
+
+    void opVariableStreamAsync(Ice::StreamedSequence<Test::Variable>, std::string,
+                               std::function<void(const ::Test::VariableSeq&, const std::string&)>,
+                               std::function<void(std::exception_ptr)>, const Ice::Current&) override;
+
 
     void opBoolSeqAsync(std::deque<bool>,
                         std::function<void(const std::deque<bool>&, const std::deque<bool>&)>,
@@ -260,6 +268,15 @@ public:
                                            std::deque<Test::Variable>::const_iterator>&,
                                            const Ice::Current&);
 
+    virtual void opFixedStream_async(const Test::AMD_TestIntf_opFixedStreamPtr&,
+                                     const Ice::StreamedSequence<Test::Fixed>&,
+                                     const Ice::Current&);
+
+    virtual void opVariableStream_async(const Test::AMD_TestIntf_opVariableStreamPtr&,
+                                        const Ice::StreamedSequence<Test::Variable>&,
+                                        const std::string&,
+                                        const Ice::Current&);
+
     virtual void opBoolSeq_async(const Test::AMD_TestIntf_opBoolSeqPtr&,
                                  const std::deque<bool>&,
                                  const Ice::Current&);
@@ -144,6 +144,22 @@ TestIntfI::opVariableRangeType(
 
 #endif
 
+Test::FixedSeq
+TestIntfI::opFixedStream(ICE_IN(Ice::StreamedSequence<Test::Fixed>) inSeq, const Ice::Current&)
+{
+    return Test::FixedSeq(inSeq.begin(), inSeq.end());
+}
+
+Test::VariableSeq
+TestIntfI::opVariableStream(ICE_IN(Ice::StreamedSequence<Test::Variable>) inSeq,
+                            ICE_IN(std::string) tail,
+                            std::string& outTail,
+                            const Ice::Current&)
+{
+    outTail = tail;
+    return Test::VariableSeq(inSeq.begin(), inSeq.end());
+}
+
 std::deque<bool>
 TestIntfI::opBoolSeq(ICE_IN(std::deque<bool>) inSeq,
                      std::deque<bool>& outSeq,
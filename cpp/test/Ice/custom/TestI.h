@@ -84,6 +84,13 @@ public:
                         const Ice::Current&);
 #endif
 
+    virtual Test::FixedSeq opFixedStream(ICE_IN(Ice::StreamedSequence<Test::Fixed>), const Ice::Current&);
+
+    virtual Test::VariableSeq opVariableStream(ICE_IN(Ice::StreamedSequence<Test::Variable>),
+                                               ICE_IN(std::string),
+                                               std::string&,
+                                               const Ice::Current&);
+
     virtual std::deque<bool> opBoolSeq(ICE_IN(std::deque<bool>),
                                        std::deque<bool>&,
                                        const Ice::Current&);
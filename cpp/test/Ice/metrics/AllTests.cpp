@@ -880,7 +880,7 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
 
     IceMX::DispatchMetricsPtr dm1 = ICE_DYNAMIC_CAST(IceMX::DispatchMetrics, map["op"]);
     test(dm1->current <= 1 && dm1->total == 1 && dm1->failures == 0 && dm1->userException == 0);
-    test(dm1->size == 21 && dm1->replySize == 7);
+    test(dm1->size == 21 && dm1->replySize == 7 && dm1->reallocations == 0);
 
     dm1 = ICE_DYNAMIC_CAST(IceMX::DispatchMetrics, map["opWithUserException"]);
     test(dm1->current <= 1 && dm1->total == 1 && dm1->failures == 0 && dm1->userException == 1);
@@ -1261,6 +1261,7 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
     IceMX::ChildInvocationMetricsPtr rim1;
     im1 = ICE_DYNAMIC_CAST(IceMX::InvocationMetrics, map["op"]);
     test(im1->current <= 1 && im1->total == 3 && im1->failures == 0 && im1->retry == 0);
+    test(im1->reallocations == 0 && im1->hedged == 0 && im1->retryBudgetExhausted == 0);
     test(!collocated ? (im1->remotes.size() == 1) : (im1->collocated.size() == 1));
     rim1 = ICE_DYNAMIC_CAST(IceMX::ChildInvocationMetrics, !collocated ? im1->remotes[0] : im1->collocated[0]);
     test(rim1->current == 0 && rim1->total == 3 && rim1->failures == 0);
@@ -195,4 +195,89 @@ batchOneways(const Test::MyClassPrxPtr& p)
         ic->destroy();
     }
 
+    test(batch->ice_getBatchAutoFlushSize() == -1 && batch->ice_getBatchAutoFlushDelay() == -1);
+    try
+    {
+        batch->ice_batchAutoFlush(-2, 0);
+        test(false);
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+    }
+
+    //
+    // The queued requests are flushed once the auto-flush delay expires.
+    //
+    Test::MyClassPrxPtr delayBatch = batch->ice_batchAutoFlush(-1, 50);
+    test(delayBatch->ice_getBatchAutoFlushDelay() == 50);
+    p->opByteSOnewayCallCount(); // Reset the call count
+    delayBatch->opByteSOneway(bs1);
+    delayBatch->opByteSOneway(bs1);
+    count = 0;
+    while(count < 2)
+    {
+        count += p->opByteSOnewayCallCount();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+    }
+
+    //
+    // The auto-flush size of the proxy overrides the communicator setting.
+    //
+    Test::MyClassPrxPtr sizeBatch = batch->ice_batchAutoFlush(25, 0);
+    test(sizeBatch->ice_getBatchAutoFlushSize() == 25);
+    for(i = 0 ; i < 3 ; ++i)
+    {
+        sizeBatch->opByteSOneway(bs1);
+    }
+    count = 0;
+    while(count < 2) // 2 requests auto-flushed.
+    {
+        count += p->opByteSOnewayCallCount();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+    }
+    sizeBatch->ice_flushBatchRequests();
+    while(count < 3)
+    {
+        count += p->opByteSOnewayCallCount();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+    }
+    test(count == 3);
+
+    //
+    // Consecutive requests of a batch for a cpp:batch operation are
+    // dispatched together when they have the same context.
+    //
+    Test::IntS runs;
+    Test::IntS values;
+    p->opBatchRuns(values); // Reset the runs
+    values.clear();
+    for(i = 0; i < 10; ++i)
+    {
+        batch->opBatch(i);
+    }
+    batch->ice_ping();
+    Ice::Context ctx;
+    ctx["batch"] = "2";
+    for(i = 10; i < 15; ++i)
+    {
+        batch->opBatch(i, ctx);
+    }
+    for(i = 15; i < 20; ++i)
+    {
+        batch->opBatch(i);
+    }
+    batch->ice_flushBatchRequests();
+    while(values.size() < 20)
+    {
+        Test::IntS v;
+        Test::IntS r = p->opBatchRuns(v);
+        runs.insert(runs.end(), r.begin(), r.end());
+        values.insert(values.end(), v.begin(), v.end());
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+    }
+    test(runs.size() == 3 && runs[0] == 10 && runs[1] == 5 && runs[2] == 5);
+    for(i = 0; i < 20; ++i)
+    {
+        test(values[i] == i);
+    }
 }
@@ -739,6 +739,32 @@ MyDerivedClassI::opByteSOnewayCallCountAsync(function<void(int)> response,
     _opByteSOnewayCallCount = 0;
 }
 
+void
+MyDerivedClassI::opBatchAsync(vector<OpBatchArgs> args,
+                              function<void()> response,
+                              function<void(exception_ptr)>,
+                              const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    _batchRuns.push_back(static_cast<int>(args.size()));
+    for(const auto& a : args)
+    {
+        _batchValues.push_back(a.i);
+    }
+    response();
+}
+
+void
+MyDerivedClassI::opBatchRunsAsync(function<void(const Test::IntS&, const Test::IntS&)> response,
+                                  function<void(exception_ptr)>,
+                                  const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    response(_batchRuns, _batchValues);
+    _batchRuns.clear();
+    _batchValues.clear();
+}
+
 void
 MyDerivedClassI::opContextAsync(function<void(const Ice::Context&)> response,
                                 function<void(exception_ptr)>,
@@ -1654,6 +1680,28 @@ MyDerivedClassI::opByteSOnewayCallCount_async(const Test::AMD_MyClass_opByteSOne
     _opByteSOnewayCallCount = 0;
 }
 
+void
+MyDerivedClassI::opBatch_async(const Test::AMD_MyClass_opBatchPtr& cb, const vector<OpBatchArgs>& args,
+                               const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    _batchRuns.push_back(static_cast<Ice::Int>(args.size()));
+    for(vector<OpBatchArgs>::const_iterator p = args.begin(); p != args.end(); ++p)
+    {
+        _batchValues.push_back(p->i);
+    }
+    cb->ice_response();
+}
+
+void
+MyDerivedClassI::opBatchRuns_async(const Test::AMD_MyClass_opBatchRunsPtr& cb, const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    cb->ice_response(_batchRuns, _batchValues);
+    _batchRuns.clear();
+    _batchValues.clear();
+}
+
 void
 MyDerivedClassI::opContext_async(const Test::AMD_MyClass_opContextPtr& cb, const Ice::Current& c)
 {
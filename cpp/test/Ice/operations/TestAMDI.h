@@ -289,6 +289,15 @@ public:
                                              ::std::function<void(std::exception_ptr)>,
                                              const Ice::Current&);
 
+    virtual void opBatchAsync(std::vector<OpBatchArgs>,
+                              ::std::function<void()>,
+                              ::std::function<void(std::exception_ptr)>,
+                              const Ice::Current&);
+
+    virtual void opBatchRunsAsync(::std::function<void(const Test::IntS&, const Test::IntS&)>,
+                                  ::std::function<void(std::exception_ptr)>,
+                                  const Ice::Current&);
+
     virtual void opContextAsync(::std::function<void(const Ice::Context&)>,
                                 ::std::function<void(std::exception_ptr)>,
                                 const Ice::Current&);
@@ -591,6 +600,11 @@ public:
                                      const Ice::Current&);
     virtual void opByteSOnewayCallCount_async(const Test::AMD_MyClass_opByteSOnewayCallCountPtr&, const Ice::Current&);
 
+    virtual void opBatch_async(const Test::AMD_MyClass_opBatchPtr&, const std::vector<OpBatchArgs>&,
+                               const Ice::Current&);
+
+    virtual void opBatchRuns_async(const Test::AMD_MyClass_opBatchRunsPtr&, const Ice::Current&);
+
     virtual void opContext_async(const Test::AMD_MyClass_opContextPtr&, const Ice::Current&);
 
     virtual void opDoubleMarshaling_async(const Test::AMD_MyClass_opDoubleMarshalingPtr&,
@@ -691,6 +705,8 @@ private:
 
     IceUtil::Mutex _mutex;
     int _opByteSOnewayCallCount;
+    Test::IntS _batchRuns;
+    Test::IntS _batchValues;
 };
 
 #endif
@@ -647,6 +647,28 @@ MyDerivedClassI::opByteSOnewayCallCount(const Ice::Current&)
     return count;
 }
 
+void
+MyDerivedClassI::opBatch(ICE_IN(std::vector<OpBatchArgs>) args, const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    _batchRuns.push_back(static_cast<Ice::Int>(args.size()));
+    for(std::vector<OpBatchArgs>::const_iterator p = args.begin(); p != args.end(); ++p)
+    {
+        _batchValues.push_back(p->i);
+    }
+}
+
+Test::IntS
+MyDerivedClassI::opBatchRuns(Test::IntS& values, const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    Test::IntS runs;
+    runs.swap(_batchRuns);
+    values.clear();
+    values.swap(_batchValues);
+    return runs;
+}
+
 Test::StringStringD
 MyDerivedClassI::opContext(const Ice::Current& c)
 {
@@ -265,6 +265,10 @@ public:
     virtual void opByteSOneway(ICE_IN(Test::ByteS), const Ice::Current&);
     virtual int opByteSOnewayCallCount(const Ice::Current&);
 
+    virtual void opBatch(ICE_IN(std::vector<OpBatchArgs>), const Ice::Current&);
+
+    virtual Test::IntS opBatchRuns(Test::IntS&, const Ice::Current&);
+
     virtual Ice::Context opContext(const Ice::Current&);
 
     virtual void opDoubleMarshaling(Ice::Double, ICE_IN(Test::DoubleS), const Ice::Current&);
@@ -335,6 +339,8 @@ private:
 
     IceUtil::Mutex _mutex;
     int _opByteSOnewayCallCount;
+    Test::IntS _batchRuns;
+    Test::IntS _batchValues;
 };
 
 #endif
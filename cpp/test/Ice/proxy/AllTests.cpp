@@ -435,6 +435,9 @@ allTests(const Ice::CommunicatorPtr& communicator)
     prop->setProperty(property, "Ordered");
     b1 = communicator->propertyToProxy(propertyPrefix);
     test(b1->ice_getEndpointSelection() == Ice::Ordered);
+    prop->setProperty(property, "Adaptive");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getEndpointSelection() == Ice::Adaptive);
     prop->setProperty(property, "");
 
     property = propertyPrefix + ".CollocationOptimized";
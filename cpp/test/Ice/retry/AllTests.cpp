@@ -339,5 +339,140 @@ allTests(const Ice::CommunicatorPtr& communicator, const Ice::CommunicatorPtr& c
     }
     cout << "ok" << endl;
 
+    if(retry1->ice_getConnection())
+    {
+        cout << "testing hedged requests... " << flush;
+        try
+        {
+            retry1->ice_hedge(-2, 1);
+            test(false);
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+        }
+        try
+        {
+            retry1->ice_hedge(100, -1);
+            test(false);
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+        }
+        test(retry1->ice_getHedgeDelay() == -1 && retry1->ice_getHedgeMax() == 0);
+
+        RetryPrxPtr prx = retry1->ice_hedge(100, 1);
+        test(prx->ice_getHedgeDelay() == 100 && prx->ice_getHedgeMax() == 1);
+#ifdef ICE_CPP11_MAPPING
+        test(!Ice::targetEqualTo(prx, retry1));
+#else
+        test(prx != retry1);
+#endif
+        testInvocationCount(-1);
+        testFailureCount(-1);
+        testHedgeCount(-1);
+
+        //
+        // The first request is delayed by the server, the hedged
+        // request sent after the hedge delay replies first.
+        //
+        retry1->opHedge(-1);
+        test(prx->opHedge(500) == 2);
+        testHedgeCount(1);
+        testInvocationCount(2);
+        testFailureCount(0);
+
+        retry1->opHedge(-1);
+#ifdef ICE_CPP11_MAPPING
+        test(prx->opHedgeAsync(500).get() == 2);
+#else
+        test(prx->end_opHedge(prx->begin_opHedge(500)) == 2);
+#endif
+        testHedgeCount(1);
+        testInvocationCount(2);
+        testFailureCount(0);
+
+        //
+        // No hedged request is sent if the reply is received within
+        // the hedge delay.
+        //
+        prx = retry1->ice_hedge(5000, 1);
+        retry1->opHedge(-1);
+        test(prx->opHedge(0) == 1);
+        test(prx->opHedge(0) == 2);
+        testHedgeCount(0);
+        testInvocationCount(3);
+
+        //
+        // The invocation timeout applies to the hedged invocation.
+        //
+        prx = retry1->ice_hedge(100, 1)->ice_invocationTimeout(300);
+        retry1->opHedge(-1);
+        test(prx->opHedge(500) == 2);
+        testHedgeCount(1);
+        testInvocationCount(2);
+
+        prx = retry1->ice_hedge(500, 1)->ice_invocationTimeout(200);
+        retry1->opHedge(-1);
+        try
+        {
+            prx->opHedge(500);
+            test(false);
+        }
+        catch(const Ice::InvocationTimeoutException&)
+        {
+        }
+        testHedgeCount(0);
+        testInvocationCount(2);
+        testFailureCount(1);
+        cout << "ok" << endl;
+    }
+
+    if(retry1->ice_getConnection())
+    {
+        cout << "testing retry budget and backoff... " << flush;
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.RetryIntervals", "0 0 0 0");
+        initData.properties->setProperty("Ice.RetryBackoff", "1");
+        initData.properties->setProperty("Ice.RetryBackoff.Max", "4");
+        initData.properties->setProperty("Ice.RetryBudget", "50");
+        initData.properties->setProperty("Ice.RetryBudget.MinRetries", "2");
+        initData.observer = getObserver();
+        Ice::CommunicatorHolder ich = Ice::initialize(initData);
+        Ice::ObjectPrxPtr base3 = ich.communicator()->stringToProxy(retry1->ice_toString());
+        RetryPrxPtr retry3 = ICE_UNCHECKED_CAST(RetryPrx, base3);
+        testInvocationCount(-1);
+        testFailureCount(-1);
+        testRetryCount(-1);
+
+        //
+        // The budget allows 2 retries and half a retry per invocation.
+        //
+        try
+        {
+            retry3->opIdempotent(4);
+            test(false);
+        }
+        catch(const Ice::LocalException&)
+        {
+        }
+        testInvocationCount(1);
+        testFailureCount(1);
+        testRetryCount(2);
+
+        for(int i = 0; i < 5; ++i)
+        {
+            retry3->opIdempotent(-1); // Reset the counter
+        }
+        testInvocationCount(5);
+        testRetryCount(0);
+
+        test(retry3->opIdempotent(3) == 3);
+        testInvocationCount(1);
+        testFailureCount(0);
+        testRetryCount(3);
+        cout << "ok" << endl;
+    }
+
     return retry1;
 }
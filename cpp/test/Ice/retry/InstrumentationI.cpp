@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Ice.h>
+#include <Ice/ObserverHelper.h>
 #include <TestCommon.h>
 
 namespace
@@ -16,6 +17,7 @@ namespace
 int nRetry = 0;
 int nFailure = 0;
 int nInvocation = 0;
+int nHedge = 0;
 IceUtil::Mutex* staticMutex = 0;
 
 class Init
@@ -35,7 +37,7 @@ public:
 };
 Init init;
 
-class InvocationObserverI : public Ice::Instrumentation::InvocationObserver
+class InvocationObserverI : public Ice::Instrumentation::InvocationObserver, public IceInternal::HedgeObserver
 {
 public:
 
@@ -65,6 +67,13 @@ public:
         ++nRetry;
     }
 
+    virtual void
+    hedged()
+    {
+        IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(staticMutex);
+        ++nHedge;
+    }
+
     virtual void
     userException()
     {
@@ -176,6 +185,7 @@ void initCounts()
     nRetry = 0;
     nFailure = 0;
     nInvocation = 0;
+    nHedge = 0;
 }
 
 Ice::Instrumentation::CommunicatorObserverPtr
@@ -201,3 +211,9 @@ testInvocationCount(int expected)
 {
     testEqual(nInvocation, expected);
 }
+
+void
+testHedgeCount(int expected)
+{
+    testEqual(nHedge, expected);
+}
@@ -13,6 +13,7 @@
 void testRetryCount(int);
 void testFailureCount(int);
 void testInvocationCount(int);
+void testHedgeCount(int);
 
 void initCounts();
 Ice::Instrumentation::CommunicatorObserverPtr getObserver();
@@ -40,6 +40,12 @@ main(int argc, char* argv[])
         initData.properties = Ice::createProperties(argc, argv);
         initData.properties->setProperty("Ice.Warn.Dispatch", "0");
         initData.properties->setProperty("Ice.PrintStackTraces", "0");
+
+        //
+        // The hedged requests are dispatched while the first request
+        // of the invocation is still being dispatched.
+        //
+        initData.properties->setProperty("Ice.ThreadPool.Server.Size", "4");
         Ice::CommunicatorHolder ich = Ice::initialize(argc, argv, initData);
         status = run(argc, argv, ich.communicator());
     }
@@ -11,7 +11,7 @@
 #include <TestI.h>
 #include <SystemFailure.h>
 
-RetryI::RetryI() : _counter(0)
+RetryI::RetryI() : _counter(0), _hedgeCounter(0)
 {
 }
 
@@ -62,6 +62,30 @@ RetryI::opSystemException(const Ice::Current&)
     throw SystemFailure(__FILE__, __LINE__);
 }
 
+int
+RetryI::opHedge(int delay, const Ice::Current&)
+{
+    //
+    // Only the first call after the reset waits before replying, the
+    // calls for the hedged requests reply right away.
+    //
+    int counter;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(delay < 0)
+        {
+            _hedgeCounter = 0;
+            return 0;
+        }
+        counter = ++_hedgeCounter;
+    }
+    if(counter == 1)
+    {
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(delay));
+    }
+    return counter;
+}
+
 void
 RetryI::shutdown(const Ice::Current& current)
 {
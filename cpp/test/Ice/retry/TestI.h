@@ -22,11 +22,15 @@ public:
     virtual int opIdempotent(int, const Ice::Current&);
     virtual void opNotIdempotent(const Ice::Current&);
     virtual void opSystemException(const Ice::Current&);
+    virtual int opHedge(int, const Ice::Current&);
     virtual void shutdown(const Ice::Current&);
 
 private:
     
     int _counter;
+
+    IceUtil::Mutex _mutex;
+    int _hedgeCounter;
 };
 
 #endif
@@ -8,9 +8,14 @@
 // **********************************************************************
 
 #include <Ice/Ice.h>
+#include <IceUtil/FileUtil.h>
 #include <TestCommon.h>
 #include <Test.h>
 
+#ifdef ICE_CPP11_MAPPING
+#   include <unordered_map>
+#endif
+
 DEFINE_TEST("client")
 
 using namespace std;
@@ -1104,6 +1109,72 @@ run(int, char**, const Ice::CommunicatorPtr& communicator)
         test(dict2 == dict);
     }
 
+    {
+        ShortIntD dict;
+        for(Ice::Short i = 0; i < 100; ++i)
+        {
+            dict[i] = i * 10;
+        }
+        Ice::OutputStream out(communicator);
+        out.write(dict);
+        out.finished(data);
+        Ice::InputStream in(communicator, data);
+        ShortIntFlatD dict2;
+        in.read(dict2);
+        test(dict2.size() == dict.size());
+        for(ShortIntD::const_iterator p = dict.begin(); p != dict.end(); ++p)
+        {
+            test(dict2.find(p->first) != dict2.end() && dict2.find(p->first)->second == p->second);
+        }
+
+        Ice::OutputStream out2(communicator);
+        out2.write(dict2);
+        out2.finished(data);
+        Ice::InputStream in2(communicator, data);
+        ShortIntD dict3;
+        in2.read(dict3);
+        test(dict3 == dict);
+    }
+
+    {
+        //
+        // Elements that are not marshaled in key order are sorted, the
+        // first element wins for duplicate keys.
+        //
+        Ice::OutputStream out(communicator);
+        out.writeSize(3);
+        out.write(static_cast<Ice::Short>(3));
+        out.write(30);
+        out.write(static_cast<Ice::Short>(1));
+        out.write(10);
+        out.write(static_cast<Ice::Short>(3));
+        out.write(99);
+        out.finished(data);
+        Ice::InputStream in(communicator, data);
+        ShortIntFlatD dict;
+        in.read(dict);
+        test(dict.size() == 2);
+        test(dict.begin()->first == 1 && dict.begin()->second == 10);
+        test(dict.rbegin()->first == 3 && dict.rbegin()->second == 30);
+    }
+
+#ifdef ICE_CPP11_MAPPING
+    {
+        unordered_map<Ice::Short, Ice::Int> dict;
+        for(Ice::Short i = 0; i < 100; ++i)
+        {
+            dict[i] = i * 10;
+        }
+        Ice::OutputStream out(communicator);
+        out.write(dict);
+        out.finished(data);
+        Ice::InputStream in(communicator, data);
+        unordered_map<Ice::Short, Ice::Int> dict2;
+        in.read(dict2);
+        test(dict2 == dict);
+    }
+#endif
+
     {
         StringMyClassD dict;
         dict["key1"] = ICE_MAKE_SHARED(MyClass);
@@ -1290,6 +1361,85 @@ run(int, char**, const Ice::CommunicatorPtr& communicator)
         test(v == v2); // Make sure the original buffer was preserved.
     }
 
+    //
+    // Test wire size estimates and pre-sizing of the stream.
+    //
+    {
+        Ice::OutputStream out(communicator);
+        Ice::IntSeq v(1000);
+        test(Ice::wireSizeEstimate(v) == 4005); // 1000 ints + leading size (5 bytes)
+        out.reserve(Ice::wireSizeEstimate(v));
+        out.write(v);
+        test(out.pos() == 4005);
+        test(out.b.reallocations() == 0); // Verify the stream hasn't reallocated.
+    }
+    {
+        Ice::OutputStream out(communicator);
+        StringSS v;
+        v.push_back(Ice::StringSeq(300, "str"));
+        v.push_back(Ice::StringSeq());
+        out.write(v);
+        test(out.pos() == static_cast<size_t>(Ice::wireSizeEstimate(v)));
+        test(out.b.reallocations() > 0);
+    }
+    {
+        Ice::OutputStream out(communicator);
+        StringStringD d;
+        d["key1"] = "value1";
+        d["key2"] = string(500, 'v');
+        out.write(d);
+        test(out.pos() == static_cast<size_t>(Ice::wireSizeEstimate(d)));
+
+        ShortIntD d2;
+        d2[1] = 2;
+        d2[3] = 4;
+        test(Ice::wireSizeEstimate(d2) == 13); // 2 * (short + int) + leading size (1 byte)
+    }
+
+    //
+    // Test marshaling to and unmarshaling from memory mapped files.
+    //
+    {
+        const string path = "stream.bin";
+        StringStringD d;
+        d["key1"] = "value1";
+        d["key2"] = string(5000, 'v');
+
+        //
+        // The first file is large enough to marshal the data in place, for
+        // the second the stream falls back to the heap.
+        //
+        const size_t sizes[] = { static_cast<size_t>(Ice::wireSizeEstimate(d)), 16 };
+        for(int i = 0; i < 2; ++i)
+        {
+            {
+                IceUtilInternal::MappedFilePtr file = new IceUtilInternal::MappedFile(path, sizes[i]);
+                Ice::OutputStream out(communicator, Ice::currentEncoding, make_pair(file->begin(), file->end()));
+                out.write(d);
+                test((out.b.begin() == file->begin()) == (i == 0));
+                file->finish(out.finished());
+            }
+
+            IceUtilInternal::MappedFilePtr file = new IceUtilInternal::MappedFile(path);
+            test(file->size() == static_cast<size_t>(Ice::wireSizeEstimate(d)));
+            Ice::InputStream in(communicator, Ice::currentEncoding, file);
+            file = 0; // The stream keeps the mapping alive.
+            StringStringD d2;
+            in.read(d2);
+            test(d2 == d);
+            try
+            {
+                Ice::Int v;
+                in.read(v);
+                test(false);
+            }
+            catch(const Ice::UnmarshalOutOfBoundsException&)
+            {
+            }
+        }
+        IceUtilInternal::unlink(path);
+    }
+
     cout << "ok" << endl;
     return 0;
 }
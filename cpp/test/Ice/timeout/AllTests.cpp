@@ -502,5 +502,217 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing deadline propagation... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.DeadlinePropagation", "1");
+        initData.properties->setProperty("TimeoutDeadline.AdapterId", "deadlineAdapter");
+        initData.properties->setProperty("TimeoutNested.AdapterId", "nestedAdapter");
+        initData.properties->setProperty("TimeoutNested.ThreadPool.Size", "1");
+        Ice::CommunicatorHolder ich = Ice::initialize(initData);
+
+        Ice::ObjectAdapterPtr adapter = ich->createObjectAdapter("TimeoutDeadline");
+        adapter->activate();
+        Ice::ObjectAdapterPtr nestedAdapter = ich->createObjectAdapter("TimeoutNested");
+        nestedAdapter->activate();
+
+        TimeoutPrxPtr timeout = ICE_UNCHECKED_CAST(TimeoutPrx, adapter->addWithUUID(ICE_MAKE_SHARED(TimeoutI)));
+        TimeoutPrxPtr nested = ICE_UNCHECKED_CAST(TimeoutPrx, nestedAdapter->addWithUUID(ICE_MAKE_SHARED(TimeoutI)));
+
+        test(timeout->getDeadline() == 0);
+        test(timeout->getNestedDeadline(nested, -1) == 0);
+
+        Ice::Long now = IceUtil::Time::now(IceUtil::Time::Monotonic).toMilliSeconds();
+        Ice::Long deadline = timeout->ice_invocationTimeout(500)->getDeadline();
+        test(deadline > now && deadline < now + 1000);
+
+        //
+        // The nested invocation inherits the deadline of the dispatch
+        // unless its own invocation timeout expires first.
+        //
+        now = IceUtil::Time::now(IceUtil::Time::Monotonic).toMilliSeconds();
+        deadline = timeout->ice_invocationTimeout(500)->getNestedDeadline(nested, -1);
+        test(deadline > now && deadline < now + 1000);
+
+        now = IceUtil::Time::now(IceUtil::Time::Monotonic).toMilliSeconds();
+        deadline = timeout->ice_invocationTimeout(5000)->getNestedDeadline(nested, 500);
+        test(deadline > now && deadline < now + 1000);
+
+        adapter->destroy();
+        nestedAdapter->destroy();
+
+        //
+        // A request which expires while waiting for a server thread
+        // isn't dispatched.
+        //
+        TimeoutPrxPtr remote = ICE_UNCHECKED_CAST(TimeoutPrx, ich->stringToProxy(sref));
+#ifdef ICE_CPP11_MAPPING
+        auto f = remote->sleepAsync(300);
+#else
+        Ice::AsyncResultPtr r = remote->begin_sleep(300);
+#endif
+        try
+        {
+            remote->ice_invocationTimeout(100)->sleep(1000);
+            test(false);
+        }
+        catch(const Ice::InvocationTimeoutException&)
+        {
+        }
+#ifdef ICE_CPP11_MAPPING
+        f.get();
+#else
+        remote->end_sleep(r);
+#endif
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        remote->op();
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::milliSeconds(700));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing admission control... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("TimeoutAdmission.Endpoints", getTestEndpoint(communicator, 2));
+        initData.properties->setProperty("TimeoutAdmission.ThreadPool.Size", "1");
+        initData.properties->setProperty("TimeoutAdmission.MaxQueuedDispatches", "1");
+        initData.properties->setProperty("TimeoutAdmission.Priority.HighOperations", "op");
+        initData.properties->setProperty("TimeoutPriority.Endpoints", getTestEndpoint(communicator, 3));
+        initData.properties->setProperty("TimeoutPriority.ThreadPool.Size", "1");
+        initData.properties->setProperty("TimeoutPriority.Priority.HighOperations", "op");
+        initData.properties->setProperty("TimeoutPriority.Priority.LowOperations", "sleep");
+        Ice::CommunicatorHolder ich = Ice::initialize(initData);
+
+        Ice::ObjectAdapterPtr adapter = ich->createObjectAdapter("TimeoutAdmission");
+        adapter->add(ICE_MAKE_SHARED(TimeoutI), Ice::stringToIdentity("admission"));
+        adapter->activate();
+        Ice::ObjectAdapterPtr priorityAdapter = ich->createObjectAdapter("TimeoutPriority");
+        priorityAdapter->add(ICE_MAKE_SHARED(TimeoutI), Ice::stringToIdentity("priority"));
+        priorityAdapter->activate();
+
+        //
+        // Requests which can't be queued because too many requests are
+        // already waiting for the server thread are rejected, high
+        // priority requests are always queued.
+        //
+        TimeoutPrxPtr admission =
+            ICE_UNCHECKED_CAST(TimeoutPrx, communicator->stringToProxy("admission:" + getTestEndpoint(communicator, 2)));
+        admission->ice_ping();
+#ifdef ICE_CPP11_MAPPING
+        auto f = admission->sleepAsync(300);
+        vector<future<void>> results;
+        for(int i = 0; i < 4; ++i)
+        {
+            results.push_back(admission->sleepAsync(0));
+        }
+#else
+        Ice::AsyncResultPtr r = admission->begin_sleep(300);
+        vector<Ice::AsyncResultPtr> results;
+        for(int i = 0; i < 4; ++i)
+        {
+            results.push_back(admission->begin_sleep(0));
+        }
+#endif
+        admission->op();
+        int rejected = 0;
+        for(int i = 0; i < 4; ++i)
+        {
+            try
+            {
+#ifdef ICE_CPP11_MAPPING
+                results[i].get();
+#else
+                admission->end_sleep(results[i]);
+#endif
+            }
+            catch(const Ice::UnknownLocalException& ex)
+            {
+                test(ex.unknown.find("overloaded") != string::npos);
+                ++rejected;
+            }
+        }
+        test(rejected > 0);
+#ifdef ICE_CPP11_MAPPING
+        f.get();
+#else
+        admission->end_sleep(r);
+#endif
+
+        //
+        // A high priority request is dispatched before the low priority
+        // requests received earlier.
+        //
+        TimeoutPrxPtr priority =
+            ICE_UNCHECKED_CAST(TimeoutPrx, communicator->stringToProxy("priority:" + getTestEndpoint(communicator, 3)));
+        priority->ice_ping();
+#ifdef ICE_CPP11_MAPPING
+        auto f1 = priority->sleepAsync(300);
+        auto f2 = priority->sleepAsync(100);
+        auto f3 = priority->sleepAsync(100);
+        priority->op();
+        test(f3.wait_for(chrono::seconds(0)) != future_status::ready);
+        f1.get();
+        f2.get();
+        f3.get();
+#else
+        Ice::AsyncResultPtr r1 = priority->begin_sleep(300);
+        Ice::AsyncResultPtr r2 = priority->begin_sleep(100);
+        Ice::AsyncResultPtr r3 = priority->begin_sleep(100);
+        priority->op();
+        test(!r3->isCompleted());
+        priority->end_sleep(r1);
+        priority->end_sleep(r2);
+        priority->end_sleep(r3);
+#endif
+    }
+    cout << "ok" << endl;
+
+    cout << "testing dispatch limit per connection... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("TimeoutLimit.Endpoints", getTestEndpoint(communicator, 2));
+        initData.properties->setProperty("TimeoutLimit.ThreadPool.Size", "2");
+        initData.properties->setProperty("TimeoutLimit.MaxDispatchesPerConnection", "1");
+        Ice::CommunicatorHolder ich = Ice::initialize(initData);
+
+        Ice::ObjectAdapterPtr adapter = ich->createObjectAdapter("TimeoutLimit");
+        adapter->add(ICE_MAKE_SHARED(TimeoutI), Ice::stringToIdentity("limit"));
+        adapter->activate();
+
+        //
+        // The requests of a busy connection wait for the connection to
+        // be read again and don't occupy the other server thread.
+        //
+        TimeoutPrxPtr limit =
+            ICE_UNCHECKED_CAST(TimeoutPrx, communicator->stringToProxy("limit:" + getTestEndpoint(communicator, 2)));
+        TimeoutPrxPtr busy = limit->ice_connectionId("busy");
+        busy->ice_ping();
+        limit->ice_ping();
+#ifdef ICE_CPP11_MAPPING
+        auto f1 = busy->sleepAsync(500);
+        auto f2 = busy->sleepAsync(500);
+#else
+        Ice::AsyncResultPtr r1 = busy->begin_sleep(500);
+        Ice::AsyncResultPtr r2 = busy->begin_sleep(500);
+#endif
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        limit->op();
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::milliSeconds(300));
+#ifdef ICE_CPP11_MAPPING
+        f1.get();
+        test(f2.wait_for(chrono::seconds(0)) != future_status::ready);
+        f2.get();
+#else
+        busy->end_sleep(r1);
+        test(!r2->isCompleted());
+        busy->end_sleep(r2);
+#endif
+    }
+    cout << "ok" << endl;
+
     return timeout;
 }
@@ -60,6 +60,11 @@ main(int argc, char* argv[])
         //
         initData.properties->setProperty("Ice.TCP.RcvSize", "50000");
 
+        //
+        // Drop the requests which expire before they're dispatched.
+        //
+        initData.properties->setProperty("Ice.DeadlinePropagation", "1");
+
         Ice::CommunicatorHolder ich = Ice::initialize(argc, argv, initData);
         return run(argc, argv, ich.communicator());
     }
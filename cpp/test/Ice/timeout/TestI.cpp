@@ -61,6 +61,18 @@ TimeoutI::holdAdapter(Ice::Int to, const Ice::Current& current)
     threadControl.detach();
 }
 
+Ice::Long
+TimeoutI::getDeadline(const Ice::Current& current)
+{
+    return current.deadline;
+}
+
+Ice::Long
+TimeoutI::getNestedDeadline(ICE_IN(Test::TimeoutPrxPtr) prx, Ice::Int to, const Ice::Current&)
+{
+    return prx->ice_invocationTimeout(to)->getDeadline();
+}
+
 void
 TimeoutI::shutdown(const Ice::Current& current)
 {
@@ -21,6 +21,8 @@ public:
     virtual void sendData(ICE_IN(Test::ByteSeq), const Ice::Current&);
     virtual void sleep(Ice::Int, const Ice::Current&);
     virtual void holdAdapter(Ice::Int, const Ice::Current&);
+    virtual Ice::Long getDeadline(const Ice::Current&);
+    virtual Ice::Long getNestedDeadline(ICE_IN(Test::TimeoutPrxPtr), Ice::Int, const Ice::Current&);
     virtual void shutdown(const Ice::Current&);
 };
 
@@ -67,6 +67,13 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^Ice\.Admin\.MessageSizeMax$", false, null),
+             new Property(@"^Ice\.Admin\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^Ice\.Admin\.MaxQueuedDispatches$", false, null),
+             new Property(@"^Ice\.Admin\.Priority\.Context$", false, null),
+             new Property(@"^Ice\.Admin\.Priority\.HighCategories$", false, null),
+             new Property(@"^Ice\.Admin\.Priority\.HighOperations$", false, null),
+             new Property(@"^Ice\.Admin\.Priority\.LowCategories$", false, null),
+             new Property(@"^Ice\.Admin\.Priority\.LowOperations$", false, null),
              new Property(@"^Ice\.Admin\.DelayCreation$", false, null),
              new Property(@"^Ice\.Admin\.Enabled$", false, null),
              new Property(@"^Ice\.Admin\.Facets$", false, null),
@@ -78,12 +85,16 @@ namespace IceInternal
              new Property(@"^Ice\.BackgroundLocatorCacheUpdates$", false, null),
              new Property(@"^Ice\.BatchAutoFlush$", true, null),
              new Property(@"^Ice\.BatchAutoFlushSize$", false, null),
+             new Property(@"^Ice\.BatchAutoFlushDelay$", false, null),
              new Property(@"^Ice\.ChangeUser$", false, null),
+             new Property(@"^Ice\.CircuitBreaker\.FailureThreshold$", false, null),
+             new Property(@"^Ice\.CircuitBreaker\.OpenTimeout$", false, null),
              new Property(@"^Ice\.ClientAccessPolicyProtocol$", false, null),
              new Property(@"^Ice\.Compression\.Level$", false, null),
              new Property(@"^Ice\.CollectObjects$", false, null),
              new Property(@"^Ice\.Config$", false, null),
              new Property(@"^Ice\.ConsoleListener$", false, null),
+             new Property(@"^Ice\.DeadlinePropagation$", false, null),
              new Property(@"^Ice\.Default\.CollocationOptimized$", false, null),
              new Property(@"^Ice\.Default\.EncodingVersion$", false, null),
              new Property(@"^Ice\.Default\.EndpointSelection$", false, null),
@@ -144,6 +155,11 @@ namespace IceInternal
              new Property(@"^Ice\.PrintStackTraces$", false, null),
              new Property(@"^Ice\.ProgramName$", false, null),
              new Property(@"^Ice\.RetryIntervals$", false, null),
+             new Property(@"^Ice\.RetryBackoff$", false, null),
+             new Property(@"^Ice\.RetryBackoff\.Max$", false, null),
+             new Property(@"^Ice\.RetryBudget$", false, null),
+             new Property(@"^Ice\.RetryBudget\.MinRetries$", false, null),
+             new Property(@"^Ice\.RequestHandlerCacheSize$", false, null),
              new Property(@"^Ice\.ServerIdleTime$", false, null),
              new Property(@"^Ice\.SOCKSProxyHost$", false, null),
              new Property(@"^Ice\.SOCKSProxyPort$", false, null),
@@ -244,6 +260,13 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Priority\.Context$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Priority\.LowOperations$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Close$", false, null),
@@ -281,6 +304,13 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceDiscovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Priority\.Context$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Priority\.LowOperations$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Close$", false, null),
@@ -318,6 +348,13 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceDiscovery\.Locator\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Priority\.Context$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Priority\.LowOperations$", false, null),
              new Property(@"^IceDiscovery\.Lookup$", false, null),
              new Property(@"^IceDiscovery\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.RetryCount$", false, null),
@@ -368,6 +405,13 @@ namespace IceInternal
              new Property(@"^IceGridDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.Priority\.Context$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.Priority\.LowOperations$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.ACM\.Close$", false, null),
@@ -405,6 +449,13 @@ namespace IceInternal
              new Property(@"^IceGridDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.Priority\.Context$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.Priority\.LowOperations$", false, null),
              new Property(@"^IceGridDiscovery\.Lookup$", false, null),
              new Property(@"^IceGridDiscovery\.Timeout$", false, null),
              new Property(@"^IceGridDiscovery\.RetryCount$", false, null),
@@ -503,6 +554,13 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Priority\.Context$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Priority\.LowOperations$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.Observers$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.SaveToRegistry$", false, null),
              null
@@ -547,6 +605,13 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Priority\.Context$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Priority\.LowOperations$", false, null),
              new Property(@"^IceGrid\.InstanceName$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Heartbeat$", false, null),
@@ -585,6 +650,13 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceGrid\.Node\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Node\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceGrid\.Node\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceGrid\.Node\.Priority\.Context$", false, null),
+             new Property(@"^IceGrid\.Node\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceGrid\.Node\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceGrid\.Node\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceGrid\.Node\.Priority\.LowOperations$", false, null),
              new Property(@"^IceGrid\.Node\.AllowRunningServersAsRoot$", false, null),
              new Property(@"^IceGrid\.Node\.AllowEndpointsOverride$", false, null),
              new Property(@"^IceGrid\.Node\.CollocateRegistry$", false, null),
@@ -662,6 +734,13 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Priority\.Context$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Priority\.LowOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.PreferSecure$", false, null),
@@ -709,6 +788,13 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Priority\.Context$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Priority\.LowOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.CryptPasswords$", false, null),
              new Property(@"^IceGrid\.Registry\.DefaultTemplates$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM\.Timeout$", false, null),
@@ -748,6 +834,13 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Priority\.Context$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Priority\.LowOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Enabled$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Address$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Port$", false, null),
@@ -790,6 +883,13 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Priority\.Context$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Priority\.LowOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.MapSize$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.Path$", false, null),
              new Property(@"^IceGrid\.Registry\.NodeSessionTimeout$", false, null),
@@ -844,6 +944,13 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Priority\.Context$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Priority\.LowOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionFilters$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Heartbeat$", false, null),
@@ -882,6 +989,13 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Priority\.Context$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Priority\.HighCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Priority\.HighOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Priority\.LowCategories$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Priority\.LowOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.ConnectionCached$", false, null),
@@ -948,6 +1062,13 @@ namespace IceInternal
              new Property(@"^IcePatch2\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^IcePatch2\.MessageSizeMax$", false, null),
+             new Property(@"^IcePatch2\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^IcePatch2\.MaxQueuedDispatches$", false, null),
+             new Property(@"^IcePatch2\.Priority\.Context$", false, null),
+             new Property(@"^IcePatch2\.Priority\.HighCategories$", false, null),
+             new Property(@"^IcePatch2\.Priority\.HighOperations$", false, null),
+             new Property(@"^IcePatch2\.Priority\.LowCategories$", false, null),
+             new Property(@"^IcePatch2\.Priority\.LowOperations$", false, null),
              new Property(@"^IcePatch2\.Directory$", false, null),
              new Property(@"^IcePatch2\.InstanceName$", false, null),
              null
@@ -1065,6 +1186,13 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^Glacier2\.Client\.MessageSizeMax$", false, null),
+             new Property(@"^Glacier2\.Client\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^Glacier2\.Client\.MaxQueuedDispatches$", false, null),
+             new Property(@"^Glacier2\.Client\.Priority\.Context$", false, null),
+             new Property(@"^Glacier2\.Client\.Priority\.HighCategories$", false, null),
+             new Property(@"^Glacier2\.Client\.Priority\.HighOperations$", false, null),
+             new Property(@"^Glacier2\.Client\.Priority\.LowCategories$", false, null),
+             new Property(@"^Glacier2\.Client\.Priority\.LowOperations$", false, null),
              new Property(@"^Glacier2\.Client\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Client\.Buffered$", false, null),
              new Property(@"^Glacier2\.Client\.ForwardContext$", false, null),
@@ -1140,6 +1268,13 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadPriority$", false, null),
              new Property(@"^Glacier2\.Server\.MessageSizeMax$", false, null),
+             new Property(@"^Glacier2\.Server\.MaxDispatchesPerConnection$", false, null),
+             new Property(@"^Glacier2\.Server\.MaxQueuedDispatches$", false, null),
+             new Property(@"^Glacier2\.Server\.Priority\.Context$", false, null),
+             new Property(@"^Glacier2\.Server\.Priority\.HighCategories$", false, null),
+             new Property(@"^Glacier2\.Server\.Priority\.HighOperations$", false, null),
+             new Property(@"^Glacier2\.Server\.Priority\.LowCategories$", false, null),
+             new Property(@"^Glacier2\.Server\.Priority\.LowOperations$", false, null),
              new Property(@"^Glacier2\.Server\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Server\.Buffered$", false, null),
              new Property(@"^Glacier2\.Server\.ForwardContext$", false, null),
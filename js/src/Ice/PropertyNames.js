@@ -68,6 +68,13 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadPriority/", false, null),
     new Property("/^Ice\.Admin\.MessageSizeMax/", false, null),
+    new Property("/^Ice\.Admin\.MaxDispatchesPerConnection/", false, null),
+    new Property("/^Ice\.Admin\.MaxQueuedDispatches/", false, null),
+    new Property("/^Ice\.Admin\.Priority\.Context/", false, null),
+    new Property("/^Ice\.Admin\.Priority\.HighCategories/", false, null),
+    new Property("/^Ice\.Admin\.Priority\.HighOperations/", false, null),
+    new Property("/^Ice\.Admin\.Priority\.LowCategories/", false, null),
+    new Property("/^Ice\.Admin\.Priority\.LowOperations/", false, null),
     new Property("/^Ice\.Admin\.DelayCreation/", false, null),
     new Property("/^Ice\.Admin\.Enabled/", false, null),
     new Property("/^Ice\.Admin\.Facets/", false, null),
@@ -79,12 +86,16 @@ PropertyNames.IceProps =
     new Property("/^Ice\.BackgroundLocatorCacheUpdates/", false, null),
     new Property("/^Ice\.BatchAutoFlush/", true, null),
     new Property("/^Ice\.BatchAutoFlushSize/", false, null),
+    new Property("/^Ice\.BatchAutoFlushDelay/", false, null),
     new Property("/^Ice\.ChangeUser/", false, null),
+    new Property("/^Ice\.CircuitBreaker\.FailureThreshold/", false, null),
+    new Property("/^Ice\.CircuitBreaker\.OpenTimeout/", false, null),
     new Property("/^Ice\.ClientAccessPolicyProtocol/", false, null),
     new Property("/^Ice\.Compression\.Level/", false, null),
     new Property("/^Ice\.CollectObjects/", false, null),
     new Property("/^Ice\.Config/", false, null),
     new Property("/^Ice\.ConsoleListener/", false, null),
+    new Property("/^Ice\.DeadlinePropagation/", false, null),
     new Property("/^Ice\.Default\.CollocationOptimized/", false, null),
     new Property("/^Ice\.Default\.EncodingVersion/", false, null),
     new Property("/^Ice\.Default\.EndpointSelection/", false, null),
@@ -145,6 +156,11 @@ PropertyNames.IceProps =
     new Property("/^Ice\.PrintStackTraces/", false, null),
     new Property("/^Ice\.ProgramName/", false, null),
     new Property("/^Ice\.RetryIntervals/", false, null),
+    new Property("/^Ice\.RetryBackoff/", false, null),
+    new Property("/^Ice\.RetryBackoff\.Max/", false, null),
+    new Property("/^Ice\.RetryBudget/", false, null),
+    new Property("/^Ice\.RetryBudget\.MinRetries/", false, null),
+    new Property("/^Ice\.RequestHandlerCacheSize/", false, null),
     new Property("/^Ice\.ServerIdleTime/", false, null),
     new Property("/^Ice\.SOCKSProxyHost/", false, null),
     new Property("/^Ice\.SOCKSProxyPort/", false, null),